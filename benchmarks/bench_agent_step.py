@@ -0,0 +1,275 @@
+"""Agent-step performance benchmark suite.
+
+Measures the controller hot path in isolation over synthetic conversations of
+100 / 1k / 10k events: event append, event store reads, history
+materialization (ConversationMemory.process_events), serialization, token
+counting and condenser latency. Emits JSON suitable for CI regression
+tracking, and can compare against a stored baseline:
+
+    poetry run python benchmarks/bench_agent_step.py --output bench_results.json
+    poetry run python benchmarks/bench_agent_step.py --baseline benchmarks/baseline.json --check
+
+A run with --check exits non-zero when any stage regresses more than
+--threshold (default 1.5x) against the baseline.
+"""
+
+import argparse
+import json
+import os
+import sys
+import time
+from unittest.mock import MagicMock
+
+from openhands.core.config.agent_config import AgentConfig
+from openhands.events import EventSource, EventStream
+from openhands.events.action import CmdRunAction, MessageAction
+from openhands.events.action.message import SystemMessageAction
+from openhands.events.event_filter import EventFilter
+from openhands.events.observation import CmdOutputObservation
+from openhands.events.serialization.event import event_from_dict, event_to_dict
+from openhands.memory.condenser.impl.amortized_forgetting_condenser import (
+    AmortizedForgettingCondenser,
+)
+from openhands.memory.conversation_memory import ConversationMemory
+from openhands.memory.view import View
+from openhands.storage.memory import InMemoryFileStore
+from openhands.utils.prompt import PromptManager
+
+SIZES = [100, 1_000, 10_000]
+
+
+def _make_events(count: int) -> list:
+    """A synthetic conversation: system + user prompt, then cmd/output pairs."""
+    events: list = []
+    system_message = SystemMessageAction(content='You are a helpful agent.')
+    system_message._source = EventSource.AGENT
+    events.append(system_message)
+    user_message = MessageAction(content='Please list the files, repeatedly.')
+    user_message._source = EventSource.USER
+    events.append(user_message)
+    index = 0
+    while len(events) < count:
+        action = CmdRunAction(command=f'ls -la /workspace/dir_{index}')
+        action._source = EventSource.AGENT
+        events.append(action)
+        if len(events) < count:
+            observation = CmdOutputObservation(
+                command=f'ls -la /workspace/dir_{index}',
+                content='\n'.join(f'file_{i}.txt' for i in range(20)),
+            )
+            observation._source = EventSource.AGENT
+            events.append(observation)
+        index += 1
+    for i, event in enumerate(events):
+        event._id = i
+    return events
+
+
+def _timed(fn) -> float:
+    start = time.perf_counter()
+    fn()
+    return time.perf_counter() - start
+
+
+def bench_event_append(count: int) -> float:
+    file_store = InMemoryFileStore()
+    event_stream = EventStream('bench', file_store)
+    events = _make_events(count)
+
+    def run() -> None:
+        for event in events:
+            event._id = -1  # add_event assigns ids
+            event_stream.add_event(event, EventSource.AGENT)
+
+    elapsed = _timed(run)
+    event_stream.close()
+    return elapsed
+
+
+def bench_event_store_scan(count: int) -> float:
+    file_store = InMemoryFileStore()
+    event_stream = EventStream('bench', file_store)
+    for event in _make_events(count):
+        event._id = -1
+        event_stream.add_event(event, EventSource.AGENT)
+    elapsed = _timed(
+        lambda: list(event_stream.search_events(filter=EventFilter()))
+    )
+    event_stream.close()
+    return elapsed
+
+
+def bench_process_events(count: int) -> float:
+    prompt_manager = MagicMock(spec=PromptManager)
+    prompt_manager.get_system_message.return_value = 'You are a helpful agent.'
+    memory = ConversationMemory(AgentConfig(), prompt_manager)
+    events = _make_events(count)
+    initial_user_action = events[1]
+    return _timed(
+        lambda: memory.process_events(
+            condensed_history=list(events),
+            initial_user_action=initial_user_action,
+        )
+    )
+
+
+def bench_incremental_step(count: int) -> float:
+    """One marginal agent step: process_events after a single new event."""
+    prompt_manager = MagicMock(spec=PromptManager)
+    prompt_manager.get_system_message.return_value = 'You are a helpful agent.'
+    memory = ConversationMemory(AgentConfig(), prompt_manager)
+    events = _make_events(count)
+    initial_user_action = events[1]
+    memory.process_events(
+        condensed_history=list(events), initial_user_action=initial_user_action
+    )
+    new_event = MessageAction(content='One more step')
+    new_event._source = EventSource.AGENT
+    new_event._id = count
+    events.append(new_event)
+    return _timed(
+        lambda: memory.process_events(
+            condensed_history=list(events),
+            initial_user_action=initial_user_action,
+        )
+    )
+
+
+def bench_serialization(count: int) -> float:
+    events = _make_events(count)
+    serialized = [event_to_dict(event) for event in events]
+
+    def run() -> None:
+        for data in serialized:
+            event_from_dict(data)
+
+    round_trip = _timed(lambda: [event_to_dict(event) for event in events])
+    return round_trip + _timed(run)
+
+
+def bench_token_counting(count: int) -> float | None:
+    try:
+        from openhands.core.config import LLMConfig
+        from openhands.llm.llm import LLM
+
+        llm = LLM(LLMConfig(model='gpt-4o'), service_id='bench')
+        messages = [
+            {'role': 'user', 'content': f'message {i} with some padding text'}
+            for i in range(count)
+        ]
+        return _timed(lambda: llm.get_token_count(messages))
+    except Exception as e:  # tokenizer assets unavailable in some environments
+        print(f'  token counting skipped: {e}', file=sys.stderr)
+        return None
+
+
+def bench_condenser(count: int) -> float:
+    condenser = AmortizedForgettingCondenser(max_size=80, keep_first=2)
+    events = _make_events(count)
+    view = View(events=events)
+
+    def run() -> None:
+        if condenser.should_condense(view):
+            condenser.get_condensation(view)
+
+    return _timed(run)
+
+
+STAGES = {
+    'event_append': bench_event_append,
+    'event_store_scan': bench_event_store_scan,
+    'process_events_full': bench_process_events,
+    'process_events_incremental_step': bench_incremental_step,
+    'serialization': bench_serialization,
+    'token_counting': bench_token_counting,
+    'condenser': bench_condenser,
+}
+
+
+def run_benchmarks(sizes: list[int]) -> dict:
+    results: dict = {}
+    for size in sizes:
+        print(f'== {size} events ==')
+        results[str(size)] = {}
+        for stage, fn in STAGES.items():
+            elapsed = fn(size)
+            if elapsed is None:
+                continue
+            results[str(size)][stage] = round(elapsed, 6)
+            print(f'  {stage}: {elapsed * 1000:.2f} ms')
+    return results
+
+
+def compare_to_baseline(results: dict, baseline: dict, threshold: float) -> list[str]:
+    regressions = []
+    for size, stages in baseline.items():
+        for stage, baseline_time in stages.items():
+            current = results.get(size, {}).get(stage)
+            if current is None or baseline_time <= 0:
+                continue
+            ratio = current / baseline_time
+            if ratio > threshold:
+                regressions.append(
+                    f'{stage} @ {size} events: {current * 1000:.2f} ms vs '
+                    f'baseline {baseline_time * 1000:.2f} ms ({ratio:.2f}x)'
+                )
+    return regressions
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('--output', help='Write results JSON to this path')
+    parser.add_argument('--baseline', help='Baseline JSON to compare against')
+    parser.add_argument(
+        '--check',
+        action='store_true',
+        help='Exit non-zero when a stage regresses past --threshold',
+    )
+    parser.add_argument('--threshold', type=float, default=1.5)
+    parser.add_argument(
+        '--sizes',
+        default=','.join(str(size) for size in SIZES),
+        help='Comma-separated synthetic conversation sizes',
+    )
+    args = parser.parse_args()
+
+    if args.check and not args.baseline:
+        parser.error('--check requires --baseline')
+
+    baseline_available = bool(args.baseline) and os.path.exists(args.baseline)
+    if args.baseline and not baseline_available:
+        print(
+            f'No baseline found at {args.baseline}.\n'
+            'Create one on a quiet CI-class machine with:\n'
+            f'  poetry run python benchmarks/bench_agent_step.py --output {args.baseline}\n'
+            'Skipping the regression check.',
+            file=sys.stderr,
+        )
+        if not args.output:
+            return 0  # check-only invocation - nothing else to do
+
+    sizes = [int(size) for size in args.sizes.split(',')]
+    results = run_benchmarks(sizes)
+
+    if args.output:
+        with open(args.output, 'w') as f:
+            json.dump(results, f, indent=2)
+        print(f'Results written to {args.output}')
+
+    if baseline_available:
+        with open(args.baseline) as f:
+            baseline = json.load(f)
+        regressions = compare_to_baseline(results, baseline, args.threshold)
+        if regressions:
+            print('Performance regressions detected:', file=sys.stderr)
+            for regression in regressions:
+                print(f'  {regression}', file=sys.stderr)
+            if args.check:
+                return 1
+        else:
+            print('No regressions against baseline.')
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -264,7 +264,7 @@ def pre_login(
             logger.debug(obs, extra={'msg_type': 'OBSERVATION'})
             if save_screenshots:
                 image_data = base64.b64decode(
-                    obs.screenshot.replace('data:image/png;base64,', '')
+                    obs.screenshot.split(',')[-1]
                 )
                 with open(os.path.join(directory, f'{image_id}.png'), 'wb') as file:
                     file.write(image_data)
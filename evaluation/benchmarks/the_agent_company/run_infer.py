@@ -155,7 +155,7 @@ def run_solver(
         for image_id, obs in enumerate(state.history):
             if isinstance(obs, BrowserOutputObservation):
                 image_data = base64.b64decode(
-                    obs.screenshot.replace('data:image/png;base64,', '')
+                    obs.screenshot.split(',')[-1]
                 )
                 with open(
                     os.path.join(screenshots_dir, f'{image_id}.png'), 'wb'
@@ -163,7 +163,7 @@ def run_solver(
                     file.write(image_data)
                 if obs.set_of_marks:
                     som_image_data = base64.b64decode(
-                        obs.set_of_marks.replace('data:image/png;base64,', '')
+                        obs.set_of_marks.split(',')[-1]
                     )
                     with open(
                         os.path.join(screenshots_dir, f'{image_id}_som.png'), 'wb'
@@ -7,6 +7,8 @@ import signal
 import subprocess
 import time
 import traceback
+from collections import deque
+from concurrent.futures import FIRST_COMPLETED, Future, ProcessPoolExecutor, wait
 from contextlib import contextmanager
 from inspect import signature
 from typing import Any, Awaitable, Callable, Optional, TextIO
@@ -74,6 +76,11 @@ class EvalOutput(BaseModel):
     metrics: dict[str, Any] | None = None
     error: str | None = None
 
+    # Per-instance scheduling info, filled in by the evaluation harness
+    runtime_seconds: float | None = None
+    attempts: int | None = None
+    timed_out: bool | None = None
+
     # Optionally save the input test instance
     instance: dict[str, Any] | None = None
 
@@ -401,6 +408,7 @@ def _process_instance_wrapper(
 ) -> EvalOutput:
     """Wrap the process_instance_func to handle retries and errors."""
     runtime_failure_count = 0
+    start_time = time.monotonic()
     for attempt in range(max_retries + 1):
         try:
             kwargs = {}
@@ -414,6 +422,8 @@ def _process_instance_wrapper(
                     result = process_instance_func(instance, metadata, use_mp, **kwargs)
             else:
                 result = process_instance_func(instance, metadata, use_mp, **kwargs)
+            result.runtime_seconds = time.monotonic() - start_time
+            result.attempts = attempt + 1
             return result
         except EvalTimeoutException as e:
             error = f'Timeout after {timeout_seconds} seconds'
@@ -430,6 +440,9 @@ def _process_instance_wrapper(
                 instance_id=instance.instance_id,
                 test_result={},
                 error=error,
+                runtime_seconds=time.monotonic() - start_time,
+                attempts=attempt + 1,
+                timed_out=True,
             )
         except Exception as e:
             error = str(e)
@@ -490,6 +503,168 @@ def _process_instance_wrapper_mp(args):
     return _process_instance_wrapper(*args)
 
 
+class InstanceClaims:
+    """File-based instance claims so several nodes can share one sweep.
+
+    Claims live in a directory on a shared filesystem. Each node atomically
+    claims an instance before running it, marks it done afterwards, and may
+    reclaim a claim whose lease expired without completing (a dead or stuck
+    node), so instances are dynamically re-assigned instead of lost.
+    """
+
+    def __init__(self, claim_dir: str, lease_seconds: float):
+        self.claim_dir = claim_dir
+        self.lease_seconds = lease_seconds
+        os.makedirs(claim_dir, exist_ok=True)
+
+    def _claim_path(self, instance_id: str) -> str:
+        return os.path.join(self.claim_dir, f'{instance_id}.claim')
+
+    def _done_path(self, instance_id: str) -> str:
+        return os.path.join(self.claim_dir, f'{instance_id}.done')
+
+    def try_claim(self, instance_id: str) -> bool:
+        """Atomically claim an instance; False if another node holds it."""
+        if os.path.exists(self._done_path(instance_id)):
+            return False
+        path = self._claim_path(instance_id)
+        while True:
+            try:
+                fd = os.open(path, os.O_CREAT | os.O_EXCL | os.O_WRONLY)
+                with os.fdopen(fd, 'w') as f:
+                    f.write(f'{os.uname().nodename}:{os.getpid()}:{time.time()}')
+                return True
+            except FileExistsError:
+                try:
+                    age = time.time() - os.path.getmtime(path)
+                except OSError:
+                    continue  # claim vanished underneath us - retry
+                if age > self.lease_seconds:
+                    # The holder is presumed dead; reclaim
+                    try:
+                        os.remove(path)
+                    except OSError:
+                        pass
+                    continue
+                return False
+
+    def mark_done(self, instance_id: str) -> None:
+        with open(self._done_path(instance_id), 'w') as f:
+            f.write(str(time.time()))
+
+
+def _run_evaluation_work_stealing(
+    dataset: pd.DataFrame,
+    metadata: EvalMetadata | None,
+    num_workers: int,
+    process_instance_func: Callable,
+    max_retries: int,
+    timeout_seconds: int | None,
+    pbar: tqdm,
+    output_fp: TextIO,
+):
+    """Schedule instances over a shared queue with dynamic re-assignment.
+
+    Workers pull from a single pending queue; an instance that hits its
+    timeout is re-queued (up to EVAL_MAX_TIMEOUT_REASSIGNS times) onto
+    whatever worker frees up first. With EVAL_DISTRIBUTED=true, instances are
+    claimed through a shared claim directory so several nodes can work the
+    same sweep. With EVAL_SPECULATIVE_TAIL=true, idle workers at the end of
+    the sweep run duplicate attempts of the stragglers and the first result
+    wins (only safe when process_instance_func tolerates concurrent runs of
+    the same instance).
+    """
+    max_timeout_reassigns = int(os.environ.get('EVAL_MAX_TIMEOUT_REASSIGNS', '1'))
+    speculative_tail = (
+        os.environ.get('EVAL_SPECULATIVE_TAIL', 'false').lower() == 'true'
+    )
+    claims: InstanceClaims | None = None
+    if (
+        os.environ.get('EVAL_DISTRIBUTED', 'false').lower() == 'true'
+        and metadata
+        and metadata.eval_output_dir
+    ):
+        lease_seconds = float(os.environ.get('EVAL_CLAIM_LEASE_SECONDS', '3600'))
+        claims = InstanceClaims(
+            os.path.join(metadata.eval_output_dir, 'claims'), lease_seconds
+        )
+
+    pending: deque = deque()
+    for _, instance in dataset.iterrows():
+        if claims is None or claims.try_claim(instance.instance_id):
+            pending.append(instance)
+
+    instances_by_id: dict[str, pd.Series] = {}
+    reassign_counts: dict[str, int] = {}
+    speculated: set[str] = set()
+    completed: set[str] = set()
+    running: dict[Future, str] = {}
+
+    executor = ProcessPoolExecutor(max_workers=num_workers)
+    try:
+
+        def submit(instance: pd.Series) -> None:
+            instances_by_id[instance.instance_id] = instance
+            future = executor.submit(
+                _process_instance_wrapper,
+                process_instance_func,
+                instance,
+                metadata,
+                True,
+                max_retries,
+                timeout_seconds,
+            )
+            running[future] = instance.instance_id
+
+        while pending and len(running) < num_workers:
+            submit(pending.popleft())
+
+        while running:
+            done, _ = wait(list(running), return_when=FIRST_COMPLETED)
+            for future in done:
+                instance_id = running.pop(future)
+                result = future.result()
+                if instance_id in completed:
+                    continue  # a speculative duplicate lost the race
+                if (
+                    result.timed_out
+                    and reassign_counts.get(instance_id, 0) < max_timeout_reassigns
+                ):
+                    reassign_counts[instance_id] = (
+                        reassign_counts.get(instance_id, 0) + 1
+                    )
+                    logger.info(
+                        f'Re-queueing timed out instance {instance_id} '
+                        f'(re-assignment {reassign_counts[instance_id]} of '
+                        f'{max_timeout_reassigns})'
+                    )
+                    pending.append(instances_by_id[instance_id])
+                    continue
+                completed.add(instance_id)
+                if claims is not None:
+                    claims.mark_done(instance_id)
+                update_progress(result, pbar, output_fp)
+            while pending and len(running) < num_workers:
+                submit(pending.popleft())
+            if speculative_tail and not pending:
+                for instance_id in list(running.values()):
+                    if len(running) >= num_workers:
+                        break
+                    if instance_id not in speculated and instance_id not in completed:
+                        speculated.add(instance_id)
+                        logger.info(
+                            f'Speculatively re-running straggler {instance_id}'
+                        )
+                        submit(instances_by_id[instance_id])
+        executor.shutdown()
+    except BaseException:
+        # Match the old mp.Pool behavior: a fatal error (or interrupt) kills
+        # in-flight instances instead of waiting an hour for them to finish
+        executor.shutdown(wait=False, cancel_futures=True)
+        cleanup()
+        raise
+
+
 def run_evaluation(
     dataset: pd.DataFrame,
     metadata: EvalMetadata | None,
@@ -518,21 +693,16 @@ def run_evaluation(
 
     try:
         if use_multiprocessing:
-            with mp.Pool(num_workers) as pool:
-                args_iter = (
-                    (
-                        process_instance_func,
-                        instance,
-                        metadata,
-                        True,
-                        max_retries,
-                        timeout_seconds,
-                    )
-                    for _, instance in dataset.iterrows()
-                )
-                results = pool.imap_unordered(_process_instance_wrapper_mp, args_iter)
-                for result in results:
-                    update_progress(result, pbar, output_fp)
+            _run_evaluation_work_stealing(
+                dataset=dataset,
+                metadata=metadata,
+                num_workers=num_workers,
+                process_instance_func=process_instance_func,
+                max_retries=max_retries,
+                timeout_seconds=timeout_seconds,
+                pbar=pbar,
+                output_fp=output_fp,
+            )
         else:
             for _, instance in dataset.iterrows():
                 result = _process_instance_wrapper(
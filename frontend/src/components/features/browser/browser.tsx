@@ -12,8 +12,10 @@ export function BrowserPanel() {
     reset();
   }, [conversationId, reset]);
 
+  // Screenshots may arrive as png, webp or jpeg data URLs depending on the
+  // runtime's BROWSER_SCREENSHOT_FORMAT; pass any data URL through untouched
   const imgSrc =
-    screenshotSrc && screenshotSrc.startsWith("data:image/png;base64,")
+    screenshotSrc && screenshotSrc.startsWith("data:image/")
       ? screenshotSrc
       : `data:image/png;base64,${screenshotSrc || ""}`;
 
@@ -114,6 +114,7 @@ export function ConversationSubscriptionsProvider({
         if (socket) {
           if (handler) {
             socket.off("oh_event", handler);
+            socket.off("oh_event_batch");
           }
           socket.removeAllListeners();
           socket.disconnect();
@@ -272,6 +273,9 @@ export function ConversationSubscriptionsProvider({
         });
 
         socket.on("oh_event", handleOhEvent);
+        socket.on("oh_event_batch", (events: unknown[]) =>
+          events.forEach(handleOhEvent),
+        );
 
         // Add the socket to our state first
         setConversationSockets((prev) => ({
@@ -185,6 +185,11 @@ export function WsClientProvider({
     flushPendingEvents();
   }
 
+  function handleMessageBatch(events: Record<string, unknown>[]) {
+    // Server-side fan-out coalesces rapid event sequences into one frame
+    events.forEach((event) => handleMessage(event));
+  }
+
   function handleMessage(event: Record<string, unknown>) {
     handleAssistantMessage(event);
 
@@ -395,6 +400,7 @@ export function WsClientProvider({
 
     sio.on("connect", handleConnect);
     sio.on("oh_event", handleMessage);
+    sio.on("oh_event_batch", handleMessageBatch);
     sio.on("connect_error", handleError);
     sio.on("connect_failed", handleError);
     sio.on("disconnect", handleDisconnect);
@@ -405,6 +411,7 @@ export function WsClientProvider({
     return () => {
       sio.off("connect", handleConnect);
       sio.off("oh_event", handleMessage);
+      sio.off("oh_event_batch", handleMessageBatch);
       sio.off("connect_error", handleError);
       sio.off("connect_failed", handleError);
       sio.off("disconnect", handleDisconnect);
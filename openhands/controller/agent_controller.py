@@ -46,6 +46,7 @@ from openhands.utils.posthog_tracker import (
     track_agent_task_completed,
     track_credit_limit_reached,
 )
+from openhands.utils.tracing import trace_span
 from openhands.events import (
     EventSource,
     EventStream,
@@ -482,12 +483,17 @@ class AgentController:
         if hasattr(event, 'hidden') and event.hidden:
             return
 
-        self.state_tracker.add_history(event)
+        with trace_span(
+            'agent_controller.on_event',
+            conversation_id=self.id,
+            event_type=type(event).__name__,
+        ):
+            self.state_tracker.add_history(event)
 
-        if isinstance(event, Action):
-            await self._handle_action(event)
-        elif isinstance(event, Observation):
-            await self._handle_observation(event)
+            if isinstance(event, Action):
+                await self._handle_action(event)
+            elif isinstance(event, Observation):
+                await self._handle_observation(event)
 
         should_step = self.should_step(event)
         if should_step:
@@ -895,11 +901,18 @@ class AgentController:
 
         # Synchronize spend across all llm services with the budget flag
         self.state_tracker.sync_budget_flag_with_metrics()
-        if self.agent.config.enable_stuck_detection and self._is_stuck():
-            await self._react_to_exception(
-                AgentStuckInLoopError('Agent got stuck in a loop')
-            )
-            return
+        if self.agent.config.enable_stuck_detection:
+            with trace_span(
+                'agent_controller.stuck_detection',
+                conversation_id=self.id,
+                step=self.state.iteration_flag.current_value,
+            ):
+                stuck = self._is_stuck()
+            if stuck:
+                await self._react_to_exception(
+                    AgentStuckInLoopError('Agent got stuck in a loop')
+                )
+                return
 
         try:
             self.state_tracker.run_control_flags()
@@ -928,7 +941,12 @@ class AgentController:
             action = self._replay_manager.step()
         else:
             try:
-                action = self.agent.step(self.state)
+                with trace_span(
+                    'agent_controller.llm_step',
+                    conversation_id=self.id,
+                    step=self.state.iteration_flag.current_value,
+                ):
+                    action = self.agent.step(self.state)
                 if action is None:
                     raise LLMNoActionError('No action was returned')
                 action._source = EventSource.AGENT  # type: ignore [attr-defined]
@@ -1031,7 +1049,12 @@ class AgentController:
             # Create and log metrics for frontend display
             self._prepare_metrics_for_frontend(action)
 
-            self.event_stream.add_event(action, action._source)  # type: ignore [attr-defined]
+            with trace_span(
+                'agent_controller.event_append',
+                conversation_id=self.id,
+                event_type=type(action).__name__,
+            ):
+                self.event_stream.add_event(action, action._source)  # type: ignore [attr-defined]
 
         log_level = 'info' if LOG_ALL_EVENTS else 'debug'
         self.log(log_level, str(action), extra={'msg_type': 'ACTION'})
@@ -23,7 +23,11 @@ from openhands.llm.metrics import Metrics
 from openhands.memory.view import View
 from openhands.server.services.conversation_stats import ConversationStats
 from openhands.storage.files import FileStore
-from openhands.storage.locations import get_conversation_agent_state_filename
+from openhands.storage.locations import (
+    get_conversation_agent_state_delta_dir,
+    get_conversation_agent_state_delta_filename,
+    get_conversation_agent_state_filename,
+)
 
 RESUMABLE_STATES = [
     AgentState.RUNNING,
@@ -33,6 +37,29 @@ RESUMABLE_STATES = [
 ]
 
 
+_CHEAP_FINGERPRINT_TYPES = (str, bytes, int, float, bool, type(None), Enum)
+
+
+def _field_fingerprint(value: Any) -> Any:
+    """A cheap equality fingerprint for one persisted State field."""
+    if isinstance(value, _CHEAP_FINGERPRINT_TYPES):
+        return value
+    if isinstance(value, Metrics):
+        # O(1) counters that change whenever the metrics accumulate
+        return (
+            'metrics',
+            value.accumulated_cost,
+            len(value.costs),
+            len(value.response_latencies),
+            len(value.token_usages),
+        )
+    try:
+        return ('pickle', hash(pickle.dumps(value)))
+    except Exception:
+        # Unserializable here - treat as always-changed so it is never stale
+        return object()
+
+
 # NOTE: this is deprecated
 class TrafficControlState(str, Enum):
     # default state, no rate limiting
@@ -146,9 +173,97 @@ class State:
 
         self.conversation_stats = conversation_stats  # restore reference
 
+    def get_field_fingerprints(self) -> dict[str, Any]:
+        """Cheap per-field change fingerprints of what save_to_session persists.
+
+        Used for delta persistence: comparing these against the last saved
+        fingerprints tells which fields changed on a transition, without
+        re-serializing unchanged large fields (metrics, delegate trees) on
+        every step. Immutable scalars fingerprint as their value, Metrics by
+        its O(1) counters, and everything else by the hash of its pickled
+        form.
+        """
+        fields_dict = self.__getstate__()
+        fields_dict['conversation_stats'] = None  # Saves itself, like in save_to_session
+        return {key: _field_fingerprint(value) for key, value in fields_dict.items()}
+
+    def pickle_fields(self, field_names: list[str]) -> dict[str, bytes]:
+        """Serialize only the named fields (the ones a delta must carry)."""
+        fields_dict = self.__getstate__()
+        fields_dict['conversation_stats'] = None  # Saves itself, like in save_to_session
+        return {
+            name: pickle.dumps(fields_dict[name])
+            for name in field_names
+            if name in fields_dict
+        }
+
+    def save_delta_to_session(
+        self,
+        sid: str,
+        file_store: FileStore,
+        user_id: str | None,
+        seq: int,
+        changed: dict[str, bytes],
+        removed: list[str],
+    ) -> None:
+        """Write one compact per-transition delta."""
+        payload = pickle.dumps({'changed': changed, 'removed': removed})
+        encoded = base64.b64encode(payload).decode('utf-8')
+        file_store.write(
+            get_conversation_agent_state_delta_filename(sid, seq, user_id), encoded
+        )
+
+    @staticmethod
+    def clear_session_deltas(
+        sid: str, file_store: FileStore, user_id: str | None
+    ) -> None:
+        """Remove all per-transition deltas (before writing a full snapshot)."""
+        try:
+            file_store.delete(get_conversation_agent_state_delta_dir(sid, user_id))
+        except Exception:
+            pass
+
+    @staticmethod
+    def _apply_session_deltas(
+        state: 'State',
+        sid: str,
+        file_store: FileStore,
+        user_id: str | None,
+        max_delta_seq: int | None = None,
+    ) -> None:
+        """Replay deltas written since the last full snapshot, in order.
+
+        max_delta_seq allows point-in-time recovery: only deltas with a
+        sequence number <= max_delta_seq are applied.
+        """
+        try:
+            delta_files = file_store.list(
+                get_conversation_agent_state_delta_dir(sid, user_id)
+            )
+        except FileNotFoundError:
+            return
+        sequenced = []
+        for filename in delta_files:
+            try:
+                seq = int(filename.split('/')[-1].split('.')[0])
+            except ValueError:
+                continue
+            if max_delta_seq is not None and seq > max_delta_seq:
+                continue
+            sequenced.append((seq, filename))
+        for _, filename in sorted(sequenced):
+            payload = pickle.loads(base64.b64decode(file_store.read(filename)))
+            for key, value in payload['changed'].items():
+                state.__dict__[key] = pickle.loads(value)
+            for key in payload['removed']:
+                state.__dict__.pop(key, None)
+
     @staticmethod
     def restore_from_session(
-        sid: str, file_store: FileStore, user_id: str | None = None
+        sid: str,
+        file_store: FileStore,
+        user_id: str | None = None,
+        max_delta_seq: int | None = None,
     ) -> 'State':
         """Restores the state from the previously saved session."""
         state: State
@@ -174,6 +289,15 @@ class State:
             logger.debug(f'Could not restore state from session: {e}')
             raise e
 
+        # replay any per-transition deltas written since the snapshot
+        try:
+            State._apply_session_deltas(
+                state, sid, file_store, user_id, max_delta_seq
+            )
+        except Exception as e:
+            # A broken delta must not block restoring the snapshot
+            logger.error(f'Could not apply state deltas for session {sid}: {e}')
+
         # update state
         if state.agent_state in RESUMABLE_STATES:
             state.resume_state = state.agent_state
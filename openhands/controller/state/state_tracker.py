@@ -28,12 +28,20 @@ class StateTracker:
 
     """
 
+    # Full snapshots are rewritten after this many deltas (compaction), so a
+    # restore never replays an unbounded chain
+    DELTA_COMPACTION_LIMIT = 20
+
     def __init__(
         self, sid: str | None, file_store: FileStore | None, user_id: str | None
     ):
         self.sid = sid
         self.file_store = file_store
         self.user_id = user_id
+        # Delta persistence baseline: per-field fingerprints of the state as
+        # of the last write, None until the first full snapshot
+        self._delta_base: dict | None = None
+        self._delta_seq = 0
 
         # filter out events that are not relevant to the agent
         # so they will not be included in the agent history
@@ -244,9 +252,47 @@ class StateTracker:
         return self.state.metrics.copy()
 
     def save_state(self):
-        """Save's current state to persistent store"""
+        """Save's current state to persistent store.
+
+        The first save (and every DELTA_COMPACTION_LIMIT saves thereafter)
+        writes a full snapshot; in between, cheap per-field fingerprints are
+        compared against the last write and only the fields that actually
+        changed are serialized into a compact delta - unchanged large fields
+        (metrics, delegate trees) are neither re-pickled nor re-written.
+        """
         if self.sid and self.file_store:
-            self.state.save_to_session(self.sid, self.file_store, self.user_id)
+            current_fingerprints = self.state.get_field_fingerprints()
+            if (
+                self._delta_base is None
+                or self._delta_seq >= self.DELTA_COMPACTION_LIMIT
+            ):
+                # Clear deltas before the snapshot so a crash in between
+                # leaves an older-but-consistent state, never a corrupt one
+                State.clear_session_deltas(self.sid, self.file_store, self.user_id)
+                self.state.save_to_session(self.sid, self.file_store, self.user_id)
+                self._delta_seq = 0
+            else:
+                changed_names = [
+                    key
+                    for key, fingerprint in current_fingerprints.items()
+                    if self._delta_base.get(key) != fingerprint
+                ]
+                removed = [
+                    key
+                    for key in self._delta_base
+                    if key not in current_fingerprints
+                ]
+                if changed_names or removed:
+                    self.state.save_delta_to_session(
+                        self.sid,
+                        self.file_store,
+                        self.user_id,
+                        self._delta_seq,
+                        self.state.pickle_fields(changed_names),
+                        removed,
+                    )
+                    self._delta_seq += 1
+            self._delta_base = current_fingerprints
 
         if self.state.conversation_stats:
             self.state.conversation_stats.save_metrics()
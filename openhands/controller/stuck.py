@@ -1,4 +1,5 @@
-from dataclasses import dataclass
+from collections import deque
+from dataclasses import dataclass, fields
 from typing import Optional
 
 from openhands.controller.state.state import State
@@ -34,6 +35,95 @@ class StuckDetector:
     def __init__(self, state: State):
         self.state = state
         self.stuck_analysis: Optional[StuckDetector.StuckAnalysis] = None
+        # Rolling fingerprints of the recent filtered tail, updated in O(1)
+        # per new event. They screen out the common not-stuck case so the
+        # full O(history) pattern checks only run when the tail actually
+        # repeats.
+        self.incremental = True
+        self._seen_history_len = 0
+        self._last_seen_event: Event | None = None
+        self._action_fps: deque[tuple] = deque(maxlen=4)
+        self._agent_message_fps: deque[tuple] = deque(maxlen=2)
+        self._condensation_count = 0
+        # Set when a new condensation arrives with enough total condensations
+        # for the context-window-error scenario; cleared by the full check
+        self._condensation_check_pending = False
+
+    @staticmethod
+    def _event_fingerprint(event: Event) -> tuple:
+        """An equality-class fingerprint consistent with _eq_no_pid.
+
+        _eq_no_pid(a, b) being True implies matching fingerprints, so the
+        screen never misses a loop; a hash collision only costs one run of
+        the full checks, never a false detection.
+        """
+        if (
+            isinstance(event, IPythonRunCellAction)
+            and 'edit_file_by_replace(' in event.code
+        ):
+            return ('ipython_edit', tuple(event.code.split('\n')[:3]))
+        if isinstance(event, CmdOutputObservation):
+            return ('cmd_output', event.command, event.exit_code)
+        try:
+            field_repr = repr(
+                [getattr(event, field.name) for field in fields(event)]
+            )
+        except TypeError:
+            field_repr = repr(event)
+        return (type(event).__name__, hash(field_repr))
+
+    def _sync_fingerprints(self) -> None:
+        """Ingest events added since the last call, resyncing if history was
+        rewritten (truncation / condensation)."""
+        history = self.state.history
+        if self._seen_history_len > len(history) or (
+            self._seen_history_len
+            and history[self._seen_history_len - 1] is not self._last_seen_event
+        ):
+            self._seen_history_len = 0
+            self._action_fps.clear()
+            self._agent_message_fps.clear()
+            self._condensation_count = 0
+            self._condensation_check_pending = False
+        for event in history[self._seen_history_len :]:
+            if (
+                isinstance(event, MessageAction) and event.source == EventSource.USER
+            ) or isinstance(event, (NullAction, NullObservation)):
+                continue
+            fingerprint = self._event_fingerprint(event)
+            if isinstance(event, Action):
+                self._action_fps.append(fingerprint)
+                if isinstance(event, MessageAction):
+                    self._agent_message_fps.append(fingerprint)
+            if isinstance(event, AgentCondensationObservation):
+                self._condensation_count += 1
+                # The context-window-error scenario needs 10 condensations and
+                # fires on an adjacent pair anywhere in the last 10 - any new
+                # condensation past that threshold may complete the pattern,
+                # so hand off to the full check
+                if self._condensation_count >= 10:
+                    self._condensation_check_pending = True
+        self._seen_history_len = len(history)
+        self._last_seen_event = history[-1] if history else None
+
+    def _tail_repeats(self) -> bool:
+        """Necessary condition for every loop scenario at the step where it
+        first becomes detectable."""
+        actions = self._action_fps
+        if len(actions) >= 2 and actions[-1] == actions[-2]:
+            return True
+        if (
+            len(actions) == 4
+            and actions[-1] == actions[-3]
+            and actions[-2] == actions[-4]
+        ):
+            return True
+        messages = self._agent_message_fps
+        if len(messages) == 2 and messages[-1] == messages[-2]:
+            return True
+        if self._condensation_check_pending:
+            return True
+        return False
 
     def is_stuck(self, headless_mode: bool = True) -> bool:
         """Checks if the agent is stuck in a loop.
@@ -46,6 +136,17 @@ class StuckDetector:
         Returns:
             bool: True if the agent is stuck in a loop, False otherwise.
         """
+        if self.incremental:
+            self._sync_fingerprints()
+            if not self._tail_repeats():
+                self.stuck_analysis = None
+                return False
+            # The full check below covers every pending condensation signal
+            self._condensation_check_pending = False
+        return self._check_is_stuck(headless_mode)
+
+    def _check_is_stuck(self, headless_mode: bool = True) -> bool:
+        """Run the full pattern checks over the (filtered) history."""
         filtered_history_offset = 0
         if not headless_mode:
             # In interactive mode, only look at history after the last user message
@@ -53,6 +53,8 @@ class AgentConfig(BaseModel):
     """Whether to enable plan mode, which uses the long horizon system message and add the new tool - task_tracker - for planning, tracking and executing complex tasks."""
     enable_stuck_detection: bool = Field(default=True)
     """Whether to enable stuck/loop detection. When disabled, the agent will not automatically detect and recover from loops."""
+    enable_incremental_memory: bool = Field(default=True)
+    """Whether to reuse converted messages between agent steps, converting only events added since the last step instead of the whole history."""
     condenser: CondenserConfig = Field(
         # The default condenser is set to the conversation window condenser -- if
         # we use NoOp and the conversation hits the LLM context length limit,
@@ -81,6 +81,10 @@ class LLMSummarizingCondenserConfig(BaseModel):
         default=10_000,
         description='Maximum length of the event representations to be passed to the LLM.',
     )
+    enable_pipelining: bool = Field(
+        default=False,
+        description='Whether to speculatively start the summarization in the background before the max size is reached, so the agent step does not block on it.',
+    )
 
     model_config = ConfigDict(extra='forbid')
 
@@ -151,6 +155,10 @@ class StructuredSummaryCondenserConfig(BaseModel):
         default=10_000,
         description='Maximum length of the event representations to be passed to the LLM.',
     )
+    enable_pipelining: bool = Field(
+        default=False,
+        description='Whether to speculatively start the summarization in the background before the max size is reached, so the agent step does not block on it.',
+    )
 
     model_config = ConfigDict(extra='forbid')
 
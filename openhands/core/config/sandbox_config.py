@@ -40,6 +40,8 @@ class SandboxConfig(BaseModel):
             Must be one of [1, 2, 4, 8]. Will only be used if the runtime is remote.
         enable_gpu: Whether to enable GPU.
         docker_runtime_kwargs: Additional keyword arguments to pass to the Docker runtime when running containers.
+        warm_pool_size: Number of pre-booted sandbox containers to keep per runtime image so conversations skip the container cold start. 0 disables the warm pool.
+        warm_pool_idle_timeout: Seconds after which an unclaimed warm container is reaped.
             This should be a Python dictionary literal string that will be parsed into a dictionary.
         trusted_dirs: List of directories that can be trusted to run the OpenHands CLI.
         vscode_port: The port to use for VSCode. If None, a random port will be chosen.
@@ -85,6 +87,8 @@ class SandboxConfig(BaseModel):
     remote_runtime_resource_factor: int = Field(default=1)
     enable_gpu: bool = Field(default=False)
     docker_runtime_kwargs: dict | None = Field(default=None)
+    warm_pool_size: int = Field(default=0)
+    warm_pool_idle_timeout: int = Field(default=600)
     selected_repo: str | None = Field(default=None)
     trusted_dirs: list[str] = Field(default_factory=list)
     vscode_port: int | None = Field(default=None)
@@ -1,11 +1,14 @@
+import atexit
 import copy
 import logging
 import os
+import queue
 import re
 import sys
+import threading
 import traceback
 from datetime import datetime
-from logging.handlers import TimedRotatingFileHandler
+from logging.handlers import QueueHandler, QueueListener, TimedRotatingFileHandler
 from types import TracebackType
 from typing import Any, Literal, Mapping, MutableMapping, TextIO
 
@@ -101,6 +104,72 @@ class StackInfoFilter(logging.Filter):
         return True
 
 
+class LazyStr:
+    """Defers expensive log string construction until a handler formats it.
+
+    Use for payloads that are costly to serialize (event dicts, pane content):
+
+        logger.debug('event: %s', LazyStr(lambda: json.dumps(payload)))
+
+    The callable only runs when a handler actually emits the record.
+    """
+
+    __slots__ = ('_fn',)
+
+    def __init__(self, fn) -> None:
+        self._fn = fn
+
+    def __str__(self) -> str:
+        try:
+            return str(self._fn())
+        except Exception as e:
+            return f'<lazy log formatting failed: {e}>'
+
+
+class SamplingFilter(logging.Filter):
+    """Keeps only a fraction of high-frequency records, per category.
+
+    Records opt in with extra={'sample_category': '<name>'}; rates come from
+    the LOG_SAMPLING_RATES env var (e.g. 'event:0.1,llm:0.01'). Sampling is a
+    deterministic stride (every Nth record), and is disabled entirely in
+    DEBUG mode so forensic capability is never lost when it matters.
+    """
+
+    def __init__(self, rates: dict[str, float]):
+        super().__init__()
+        self._rates = rates
+        self._counters: dict[str, int] = {}
+        self._lock = threading.Lock()
+
+    @classmethod
+    def from_env(cls) -> 'SamplingFilter':
+        rates: dict[str, float] = {}
+        for item in os.getenv('LOG_SAMPLING_RATES', '').split(','):
+            if ':' not in item:
+                continue
+            category, _, rate_str = item.partition(':')
+            try:
+                rate = float(rate_str)
+            except ValueError:
+                continue
+            if 0 < rate < 1:
+                rates[category.strip()] = rate
+        return cls(rates)
+
+    def filter(self, record: logging.LogRecord) -> bool:
+        category = getattr(record, 'sample_category', None)
+        if category is None or DEBUG:
+            return True
+        rate = self._rates.get(category)
+        if rate is None:
+            return True
+        stride = max(1, round(1 / rate))
+        with self._lock:
+            count = self._counters.get(category, 0)
+            self._counters[category] = count + 1
+        return count % stride == 0
+
+
 class NoColorFormatter(logging.Formatter):
     """Formatter for non-colored logging in files."""
 
@@ -384,6 +453,7 @@ else:
     openhands_logger.addHandler(get_console_handler(current_log_level))
 
 openhands_logger.addFilter(SensitiveDataFilter(openhands_logger.name))
+openhands_logger.addFilter(SamplingFilter.from_env())
 openhands_logger.propagate = False
 openhands_logger.debug('Logging initialized')
 
@@ -486,8 +556,20 @@ def _setup_llm_logger(name: str, log_level: int) -> logging.Logger:
     logger = logging.getLogger(name)
     logger.propagate = False
     logger.setLevel(log_level)
+    logger.addFilter(SamplingFilter.from_env())
     if LOG_TO_FILE:
-        logger.addHandler(_get_llm_file_handler(name, log_level))
+        # Buffer prompt/response records through a queue so the caller only
+        # pays for an enqueue; a background listener does the disk I/O.
+        file_handler = _get_llm_file_handler(name, log_level)
+        log_queue: queue.Queue = queue.Queue(maxsize=10_000)
+        queue_handler = QueueHandler(log_queue)
+        queue_handler.setLevel(log_level)
+        listener = QueueListener(
+            log_queue, file_handler, respect_handler_level=True
+        )
+        listener.start()
+        atexit.register(listener.stop)
+        logger.addHandler(queue_handler)
     return logger
 
 
@@ -1,4 +1,5 @@
 import asyncio
+from itertools import islice
 from typing import Any, AsyncIterator
 
 from openhands.events.event import Event
@@ -13,11 +14,17 @@ class AsyncEventStoreWrapper:
 
     async def __aiter__(self) -> AsyncIterator[Event]:
         loop = asyncio.get_running_loop()
+        iterator = iter(self.event_store.search_events(*self.args, **self.kwargs))
+        # Pull events one cache page at a time, so the blocking reads cost one
+        # thread-pool round trip per page instead of one per event.
+        page_size = getattr(self.event_store, 'cache_size', 25)
 
-        # Create an async generator that yields events
-        for event in self.event_store.search_events(*self.args, **self.kwargs):
-            # Run the blocking search_events() in a thread pool
-            def get_event(e: Event = event) -> Event:
-                return e
+        def next_page() -> list[Event]:
+            return list(islice(iterator, page_size))
 
-            yield await loop.run_in_executor(None, get_event)
+        while True:
+            page = await loop.run_in_executor(None, next_page)
+            if not page:
+                return
+            for event in page:
+                yield event
@@ -2,7 +2,7 @@ import json
 from dataclasses import dataclass
 
 from openhands.events.event import Event
-from openhands.events.serialization.event import event_to_dict
+from openhands.events.serialization.event import event_to_dict, resolve_event_type
 
 
 @dataclass
@@ -84,6 +84,42 @@ class EventFilter:
 
         return True
 
+    def include_data(self, data: dict) -> bool | None:
+        """Evaluate the filter against a serialized event without materializing it.
+
+        Returns False when the event can be rejected from its metadata alone,
+        True when it definitely passes, and None when the decision needs the
+        materialized event (a content query, or exclude_hidden - 'hidden'
+        lives in the payload). Callers use False to skip deserializing large
+        payloads during scans.
+        """
+        event_type = resolve_event_type(data)
+        if event_type is None:
+            return None
+
+        if self.include_types and not issubclass(event_type, self.include_types):
+            return False
+
+        if self.exclude_types is not None and issubclass(
+            event_type, self.exclude_types
+        ):
+            return False
+
+        if self.source and data.get('source') != self.source:
+            return False
+
+        timestamp = data.get('timestamp')
+        if self.start_date and timestamp is not None and timestamp < self.start_date:
+            return False
+
+        if self.end_date and timestamp is not None and timestamp > self.end_date:
+            return False
+
+        if self.query or self.exclude_hidden:
+            return None
+
+        return True
+
     def exclude(self, event: Event) -> bool:
         """Determine if an event should be excluded based on the filter criteria.
 
@@ -0,0 +1,131 @@
+import json
+
+from openhands.core.logger import openhands_logger as logger
+from openhands.events.event_filter import EventFilter
+from openhands.events.serialization.action import ACTION_TYPE_TO_CLASS
+from openhands.events.serialization.event import resolve_event_type
+from openhands.events.serialization.observation import OBSERVATION_TYPE_TO_CLASS
+from openhands.storage.files import FileStore
+from openhands.storage.locations import get_conversation_event_index_filename
+
+
+def _class_by_name() -> dict[str, type]:
+    classes: dict[str, type] = {}
+    for cls in ACTION_TYPE_TO_CLASS.values():
+        classes[cls.__name__] = cls
+    for cls in OBSERVATION_TYPE_TO_CLASS.values():
+        classes[cls.__name__] = cls
+    return classes
+
+
+class EventIndex:
+    """Per-conversation index of event ids by type, source and tool name.
+
+    Maintained incrementally as events are added, persisted alongside the
+    conversation, and caught up lazily for conversations that predate it.
+    Filtered searches intersect the id lists instead of deserializing every
+    event, and "latest N of type X" is a slice of an id list.
+    """
+
+    SAVE_EVERY = 25
+
+    def __init__(self, sid: str, file_store: FileStore, user_id: str | None):
+        self.sid = sid
+        self.file_store = file_store
+        self.user_id = user_id
+        self.max_id = -1
+        self.by_type: dict[str, list[int]] = {}
+        self.by_source: dict[str, list[int]] = {}
+        self.by_tool: dict[str, list[int]] = {}
+        self._dirty = 0
+
+    @classmethod
+    def load(cls, sid: str, file_store: FileStore, user_id: str | None) -> 'EventIndex':
+        index = cls(sid, file_store, user_id)
+        try:
+            content = file_store.read(
+                get_conversation_event_index_filename(sid, user_id)
+            )
+            data = json.loads(content)
+            index.max_id = data.get('max_id', -1)
+            index.by_type = data.get('by_type', {})
+            index.by_source = data.get('by_source', {})
+            index.by_tool = data.get('by_tool', {})
+        except FileNotFoundError:
+            pass
+        except Exception as e:
+            logger.warning(f'Discarding unreadable event index for {sid}: {e}')
+        return index
+
+    def ingest(self, event_id: int, data: dict | None) -> None:
+        """Record one serialized event. Must be called in increasing id order;
+        None marks an id with no stored event (a hole in the history)."""
+        if event_id <= self.max_id:
+            return
+        if data is not None:
+            event_type = resolve_event_type(data)
+            if event_type is not None:
+                self.by_type.setdefault(event_type.__name__, []).append(event_id)
+            source = data.get('source')
+            if source:
+                self.by_source.setdefault(source, []).append(event_id)
+            tool_call_metadata = data.get('tool_call_metadata')
+            if tool_call_metadata:
+                function_name = tool_call_metadata.get('function_name')
+                if function_name:
+                    self.by_tool.setdefault(function_name, []).append(event_id)
+        self.max_id = event_id
+        self._dirty += 1
+
+    def save(self) -> None:
+        if not self._dirty:
+            return
+        contents = json.dumps(
+            {
+                'max_id': self.max_id,
+                'by_type': self.by_type,
+                'by_source': self.by_source,
+                'by_tool': self.by_tool,
+            }
+        )
+        self.file_store.write(
+            get_conversation_event_index_filename(self.sid, self.user_id), contents
+        )
+        self._dirty = 0
+
+    def maybe_save(self) -> None:
+        if self._dirty >= self.SAVE_EVERY:
+            self.save()
+
+    def candidate_ids(self, filter: EventFilter) -> list[int] | None:
+        """Ids that can possibly match the filter's type/source criteria.
+
+        Returns None when the index cannot narrow the search (no indexable
+        criteria in the filter). Criteria the index does not cover (query,
+        dates, hidden) are still applied by the caller on the candidates.
+        """
+        id_sets: list[set[int]] = []
+        if filter.include_types:
+            classes = _class_by_name()
+            ids: set[int] = set()
+            for type_name, type_ids in self.by_type.items():
+                cls = classes.get(type_name)
+                if cls is not None and issubclass(cls, filter.include_types):
+                    ids.update(type_ids)
+            id_sets.append(ids)
+        if filter.source:
+            id_sets.append(set(self.by_source.get(filter.source, ())))
+        if not id_sets:
+            return None
+        candidates = set.intersection(*id_sets)
+        if filter.exclude_types:
+            classes = _class_by_name()
+            for type_name, type_ids in self.by_type.items():
+                cls = classes.get(type_name)
+                if cls is not None and issubclass(cls, filter.exclude_types):
+                    candidates.difference_update(type_ids)
+        return sorted(candidates)
+
+    def ids_of_type(self, type_name: str) -> list[int]:
+        """All ids of a concrete event type, in increasing order."""
+        return list(self.by_type.get(type_name, ()))
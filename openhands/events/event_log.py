@@ -0,0 +1,227 @@
+import json
+
+from openhands.core.logger import openhands_logger as logger
+from openhands.events.serialization.event import event_to_dict
+from openhands.storage.files import FileStore
+from openhands.storage.locations import (
+    get_conversation_event_log_dir,
+    get_conversation_event_log_index_filename,
+    get_conversation_event_log_segment_filename,
+    get_conversation_events_dir,
+)
+
+
+class SegmentedEventLog:
+    """An append-only, segmented log of serialized events.
+
+    Events are grouped into fixed size segments, each stored as a single JSONL
+    file together with a per-segment byte offset index. Reading an event is a
+    single segment read plus an offset slice instead of one file open per
+    event, and finding the max id only requires listing the (small) segment
+    directory instead of every event file.
+    """
+
+    DEFAULT_SEGMENT_SIZE = 100
+
+    def __init__(
+        self,
+        sid: str,
+        file_store: FileStore,
+        user_id: str | None = None,
+        segment_size: int = DEFAULT_SEGMENT_SIZE,
+    ) -> None:
+        self.sid = sid
+        self.file_store = file_store
+        self.user_id = user_id
+        self.segment_size = segment_size
+        # Cache of the most recently loaded segment: (base, lines)
+        self._segment_cache: tuple[int, list[str]] | None = None
+
+    def _segment_base(self, event_id: int) -> int:
+        return event_id - (event_id % self.segment_size)
+
+    def _segment_filename(self, base: int) -> str:
+        return get_conversation_event_log_segment_filename(self.sid, base, self.user_id)
+
+    def _index_filename(self, base: int) -> str:
+        return get_conversation_event_log_index_filename(self.sid, base, self.user_id)
+
+    def _load_segment(self, base: int) -> list[str]:
+        """Load the JSON lines of a segment, using the offset index for slicing."""
+        cached = self._segment_cache
+        if cached and cached[0] == base:
+            return cached[1]
+        content = self.file_store.read(self._segment_filename(base))
+        try:
+            offsets = json.loads(self.file_store.read(self._index_filename(base)))
+            lines = [
+                content[offsets[i] : offsets[i + 1]].rstrip('\n')
+                for i in range(len(offsets) - 1)
+            ]
+            lines.append(content[offsets[-1] :].rstrip('\n'))
+        except FileNotFoundError:
+            # The index is an optimization - fall back to splitting lines.
+            lines = content.rstrip('\n').split('\n') if content else []
+        self._segment_cache = (base, lines)
+        return lines
+
+    def exists(self) -> bool:
+        try:
+            return bool(
+                self.file_store.list(
+                    get_conversation_event_log_dir(self.sid, self.user_id)
+                )
+            )
+        except FileNotFoundError:
+            return False
+
+    def max_id(self) -> int:
+        """Return the highest event id in the log, or -1 if the log is empty."""
+        try:
+            segments = self.file_store.list(
+                get_conversation_event_log_dir(self.sid, self.user_id)
+            )
+        except FileNotFoundError:
+            return -1
+        max_base = -1
+        for filename in segments:
+            name = filename.split('/')[-1]
+            if not name.endswith('.jsonl'):
+                continue
+            try:
+                base = int(name.removesuffix('.jsonl'))
+            except ValueError:
+                logger.warning(f'get segment base from filename ({filename}) failed.')
+                continue
+            max_base = max(max_base, base)
+        if max_base < 0:
+            return -1
+        return max_base + len(self._load_segment(max_base)) - 1
+
+    def append(self, event_id: int, data: dict) -> None:
+        """Append a serialized event to the log.
+
+        Events must be appended in increasing id order; each id maps to a fixed
+        slot in its segment so reads can resolve ids without scanning. Skipped
+        ids (the per-event layout can have holes) are padded with null slots,
+        which read as missing events.
+
+        NOTE: a single append rewrites the active segment file (the FileStore
+        API has no true append), so the log backend is paired with the
+        write-behind queue by default - append_batch writes each touched
+        segment once per flush instead of once per event.
+        """
+        base = self._segment_base(event_id)
+        if event_id == base:
+            lines = []
+        else:
+            try:
+                lines = list(self._load_segment(base))
+            except FileNotFoundError:
+                # A gap can span a whole segment - start this one fresh.
+                lines = []
+        if len(lines) > event_id - base:
+            raise ValueError(
+                f'Event log for {self.sid} already contains id {event_id}'
+            )
+        while len(lines) < event_id - base:
+            lines.append('null')
+        lines.append(json.dumps(data))
+        self._write_segment(base, lines)
+
+    def append_batch(self, items: list[tuple[int, dict]]) -> None:
+        """Append several serialized events in one group commit.
+
+        Items are grouped by segment so each touched segment is written once,
+        however many events it receives.
+        """
+        items = sorted(items, key=lambda item: item[0])
+        index = 0
+        while index < len(items):
+            base = self._segment_base(items[index][0])
+            if items[index][0] == base:
+                lines: list[str] = []
+            else:
+                try:
+                    lines = list(self._load_segment(base))
+                except FileNotFoundError:
+                    lines = []
+            while index < len(items) and self._segment_base(items[index][0]) == base:
+                event_id, data = items[index]
+                if len(lines) > event_id - base:
+                    raise ValueError(
+                        f'Event log for {self.sid} already contains id {event_id}'
+                    )
+                while len(lines) < event_id - base:
+                    lines.append('null')
+                lines.append(json.dumps(data))
+                index += 1
+            self._write_segment(base, lines)
+
+    def _write_segment(self, base: int, lines: list[str]) -> None:
+        contents = '\n'.join(lines) + '\n'
+        self.file_store.write(self._segment_filename(base), contents)
+        # The offset index is written once, when the segment completes -
+        # reads of the active segment fall back to line splitting, and the
+        # active segment would otherwise pay a second write per append
+        if len(lines) >= self.segment_size:
+            offsets = []
+            offset = 0
+            for line in lines:
+                offsets.append(offset)
+                offset += len(line) + 1
+            self.file_store.write(self._index_filename(base), json.dumps(offsets))
+        self._segment_cache = (base, lines)
+
+    def read(self, event_id: int) -> dict:
+        """Read a single serialized event. Raises FileNotFoundError if absent."""
+        if event_id < 0:
+            raise FileNotFoundError(str(event_id))
+        base = self._segment_base(event_id)
+        lines = self._load_segment(base)
+        local_index = event_id - base
+        if local_index >= len(lines):
+            raise FileNotFoundError(str(event_id))
+        data = json.loads(lines[local_index])
+        if data is None:  # Null slot - padding for a missing event id
+            raise FileNotFoundError(str(event_id))
+        return data
+
+    def read_segment(self, base: int) -> list[dict | None]:
+        """Read all serialized events in the segment starting at base.
+
+        Null slots (missing event ids) are returned as None.
+        """
+        return [json.loads(line) for line in self._load_segment(base)]
+
+
+def migrate_to_event_log(
+    sid: str,
+    file_store: FileStore,
+    user_id: str | None = None,
+    segment_size: int = SegmentedEventLog.DEFAULT_SEGMENT_SIZE,
+    delete_event_files: bool = False,
+) -> SegmentedEventLog:
+    """Copy a conversation from the per-event file layout into a segmented log.
+
+    The migration is idempotent: events already present in the log are skipped.
+    Pass delete_event_files=True to remove the per-event files after they have
+    been copied.
+    """
+    # Deferred to avoid a circular import (EventStore reads the log).
+    from openhands.events.event_store import EventStore
+
+    log = SegmentedEventLog(sid, file_store, user_id, segment_size)
+    event_store = EventStore(sid, file_store, user_id)
+    next_id = log.max_id() + 1
+    for event in event_store.search_events(start_id=next_id):
+        log.append(event.id, event_to_dict(event))
+    if delete_event_files:
+        try:
+            for filename in file_store.list(
+                get_conversation_events_dir(sid, user_id)
+            ):
+                file_store.delete(filename)
+        except FileNotFoundError:
+            pass
+    return log
@@ -1,10 +1,13 @@
 import json
-from dataclasses import dataclass
+import os
+from dataclasses import dataclass, field
 from typing import Iterable
 
 from openhands.core.logger import openhands_logger as logger
 from openhands.events.event import Event, EventSource
 from openhands.events.event_filter import EventFilter
+from openhands.events.event_index import EventIndex
+from openhands.events.event_log import SegmentedEventLog
 from openhands.events.event_store_abc import EventStoreABC
 from openhands.events.serialization.event import event_from_dict
 from openhands.storage.files import FileStore
@@ -29,17 +32,34 @@ class _CachePage:
             return False
         return True
 
-    def get_event(self, global_index: int) -> Event | None:
+    def get_data(self, global_index: int) -> dict | None:
+        """Return the serialized event at the index, or None if not cached."""
         # If there was not actually a cached page, return None
         if not self.events:
             return None
         local_index = global_index - self.start
-        return event_from_dict(self.events[local_index])
+        if local_index >= len(self.events):
+            return None
+        # A None entry is a null slot in a segmented log page - missing event
+        return self.events[local_index]
 
 
 _DUMMY_PAGE = _CachePage(None, 1, -1)
 
 
+def _use_event_log_default() -> bool:
+    """Whether new stores default to the segmented log backend.
+
+    Controlled by the OPENHANDS_USE_EVENT_LOG env var so deployments can turn
+    the backend on without touching every construction site.
+    """
+    return os.environ.get('OPENHANDS_USE_EVENT_LOG', 'false').lower() in (
+        '1',
+        'true',
+        'yes',
+    )
+
+
 @dataclass
 class EventStore(EventStoreABC):
     """A stored list of events backing a conversation"""
@@ -48,7 +68,18 @@ class EventStore(EventStoreABC):
     file_store: FileStore
     user_id: str | None
     cache_size: int = 25
+    use_event_log: bool = field(default_factory=_use_event_log_default)
     _cur_id: int | None = None  # Private field to cache the calculated value
+    _event_log: SegmentedEventLog | None = None  # Private field, created lazily
+    _event_index: EventIndex | None = None  # Private field, created lazily
+
+    @property
+    def event_log(self) -> SegmentedEventLog:
+        """Lazy created segmented log - only read when use_event_log is set or
+        a per-event file is missing."""
+        if self._event_log is None:
+            self._event_log = SegmentedEventLog(self.sid, self.file_store, self.user_id)
+        return self._event_log
 
     @property
     def cur_id(self) -> int:
@@ -64,6 +95,11 @@ class EventStore(EventStoreABC):
 
     def _calculate_cur_id(self) -> int:
         """Calculate the current event ID based on file system content."""
+        # The segmented log only needs a listing of the (small) segment
+        # directory, so it is always cheap to consult.
+        log_max_id = self.event_log.max_id()
+        if self.use_event_log:
+            return log_max_id + 1
         events = []
         try:
             events_dir = get_conversation_events_dir(self.sid, self.user_id)
@@ -72,10 +108,10 @@ class EventStore(EventStoreABC):
             logger.debug(f'No events found for session {self.sid} at {events_dir}')
 
         if not events:
-            return 0
+            return log_max_id + 1
 
         # if we have events, we need to find the highest id to prepare for new events
-        max_id = -1
+        max_id = log_max_id
         for event_str in events:
             id = self._get_id_from_filename(event_str)
             if id >= max_id:
@@ -115,31 +151,92 @@ class EventStore(EventStoreABC):
         else:
             step = 1
 
+        id_iterator: Iterable[int] = range(start_id, end_id, step)
+        if filter is not None:
+            candidate_ids = self._candidate_ids_for_filter(
+                filter, start_id, end_id, reverse
+            )
+            if candidate_ids is not None:
+                id_iterator = candidate_ids
+
         cache_page = _DUMMY_PAGE
         num_results = 0
-        for index in range(start_id, end_id, step):
+        for index in id_iterator:
             if not should_continue():
                 return
             if not cache_page.covers(index):
                 cache_page = self._load_cache_page_for_index(index)
-            event = cache_page.get_event(index)
-            if event is None:
+            data = cache_page.get_data(index)
+            if data is None:
                 try:
-                    event = self.get_event(index)
+                    data = self._get_event_data(index)
                 except FileNotFoundError:
-                    event = None
-            if event:
-                if not filter or filter.include(event):
-                    yield event
-                    num_results += 1
-                    if limit and limit <= num_results:
-                        return
+                    continue
+            # Reject on the serialized metadata when possible, skipping
+            # materialization of large payloads the filter never looks at
+            if filter and filter.include_data(data) is False:
+                continue
+            event = event_from_dict(data)
+            if not filter or filter.include(event):
+                yield event
+                num_results += 1
+                if limit and limit <= num_results:
+                    return
+
+    def get_event_index(self) -> EventIndex:
+        """The per-conversation event index, caught up to the current id."""
+        if self._event_index is None:
+            self._event_index = EventIndex.load(self.sid, self.file_store, self.user_id)
+        index = self._event_index
+        if index.max_id < self.cur_id - 1:
+            # Catch up on events the index has not seen (one scan, amortized
+            # over every later filtered search)
+            for event_id in range(index.max_id + 1, self.cur_id):
+                try:
+                    data = self._get_event_data(event_id)
+                except FileNotFoundError:
+                    data = None
+                index.ingest(event_id, data)
+            index.save()
+        return index
+
+    def _candidate_ids_for_filter(
+        self, filter: EventFilter, start_id: int, end_id: int, reverse: bool
+    ) -> list[int] | None:
+        """Ids worth visiting for the filter, or None to scan the range."""
+        index = self.get_event_index()
+        candidates = index.candidate_ids(filter)
+        if candidates is None:
+            return None
+        # Bounds of the requested range, as [lo, hi)
+        if reverse:
+            lo, hi = end_id + 1, start_id + 1
+        else:
+            lo, hi = start_id, end_id
+        selected = {
+            event_id for event_id in candidates if lo <= event_id < hi
+        }
+        # Ids newer than the index has seen must still be scanned
+        selected.update(range(max(lo, index.max_id + 1), hi))
+        ordered = sorted(selected)
+        if reverse:
+            ordered.reverse()
+        return ordered
 
     def get_event(self, id: int) -> Event:
+        return event_from_dict(self._get_event_data(id))
+
+    def _get_event_data(self, id: int) -> dict:
+        """Read the serialized form of an event without materializing it."""
+        if self.use_event_log:
+            return self.event_log.read(id)
         filename = self._get_filename_for_id(id, self.user_id)
-        content = self.file_store.read(filename)
-        data = json.loads(content)
-        return event_from_dict(data)
+        try:
+            content = self.file_store.read(filename)
+        except FileNotFoundError:
+            # The conversation may have been migrated to the segmented log.
+            return self.event_log.read(id)
+        return json.loads(content)
 
     def get_latest_event(self) -> Event:
         return self.get_event(self.cur_id - 1)
@@ -170,6 +267,14 @@ class EventStore(EventStoreABC):
         return page
 
     def _load_cache_page_for_index(self, index: int) -> _CachePage:
+        if self.use_event_log:
+            # Segments double as cache pages - one read covers a whole segment.
+            base = index - (index % self.event_log.segment_size)
+            try:
+                events = self.event_log.read_segment(base)
+            except FileNotFoundError:
+                events = None
+            return _CachePage(events, base, base + self.event_log.segment_size)
         offset = index % self.cache_size
         index -= offset
         return self._load_cache_page(index, index + self.cache_size)
@@ -6,8 +6,14 @@ from typing import Any
 from pydantic import BaseModel
 
 from openhands.events import Event, EventSource
-from openhands.events.serialization.action import action_from_dict
-from openhands.events.serialization.observation import observation_from_dict
+from openhands.events.serialization.action import (
+    ACTION_TYPE_TO_CLASS,
+    action_from_dict,
+)
+from openhands.events.serialization.observation import (
+    OBSERVATION_TYPE_TO_CLASS,
+    observation_from_dict,
+)
 from openhands.events.serialization.utils import remove_fields
 from openhands.events.tool import ToolCallMetadata
 from openhands.llm.metrics import Cost, Metrics, ResponseLatency, TokenUsage
@@ -49,6 +55,20 @@ DELETE_FROM_TRAJECTORY_EXTRAS_AND_SCREENSHOTS = DELETE_FROM_TRAJECTORY_EXTRAS |
 }
 
 
+def resolve_event_type(data: dict) -> type[Event] | None:
+    """Resolve the concrete Event class from a serialized event's
+    action/observation discriminator, without materializing the event.
+
+    Lets scans and indexes screen events by type from their serialized
+    metadata alone, skipping payload deserialization entirely.
+    """
+    if 'action' in data:
+        return ACTION_TYPE_TO_CLASS.get(data['action'])
+    if 'observation' in data:
+        return OBSERVATION_TYPE_TO_CLASS.get(data['observation'])
+    return None
+
+
 def event_from_dict(data: dict[str, Any]) -> 'Event':
     evt: Event
     if 'action' in data:
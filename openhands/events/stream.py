@@ -1,4 +1,5 @@
 import asyncio
+import os
 import queue
 import threading
 from concurrent.futures import ThreadPoolExecutor
@@ -45,16 +46,40 @@ class EventStream(EventStore):
     # For each subscriber ID, there is a map of callback functions - useful
     # when there are multiple listeners
     _subscribers: dict[str, dict[str, Callable]]
-    _lock: threading.Lock
+    _lock: threading.RLock
     _queue: queue.Queue[Event]
     _queue_thread: threading.Thread
     _queue_loop: asyncio.AbstractEventLoop | None
     _thread_pools: dict[str, dict[str, ThreadPoolExecutor]]
     _thread_loops: dict[str, dict[str, asyncio.AbstractEventLoop]]
     _write_page_cache: list[dict]
+    _pending_writes: list[tuple[int, dict, list[dict]]]
+    _in_flight_writes: list[tuple[int, dict, list[dict]]]
 
-    def __init__(self, sid: str, file_store: FileStore, user_id: str | None = None):
+    def __init__(
+        self,
+        sid: str,
+        file_store: FileStore,
+        user_id: str | None = None,
+        write_behind: bool | None = None,
+        flush_interval: float | None = None,
+    ):
         super().__init__(sid, file_store, user_id)
+        # Deployments enable write-behind globally via env, so every
+        # production construction site picks it up without code changes.
+        # The segmented log backend rewrites its active segment per append,
+        # so it defaults to write-behind pairing: append_batch then writes
+        # each touched segment once per flush instead of once per event.
+        if write_behind is None:
+            env_value = os.environ.get('OPENHANDS_EVENT_STREAM_WRITE_BEHIND')
+            if env_value is not None:
+                write_behind = env_value.lower() in ('1', 'true', 'yes')
+            else:
+                write_behind = self.use_event_log
+        if flush_interval is None:
+            flush_interval = float(
+                os.environ.get('OPENHANDS_EVENT_STREAM_FLUSH_INTERVAL', '0.2')
+            )
         self._stop_flag = threading.Event()
         self._queue: queue.Queue[Event] = queue.Queue()
         self._thread_pools = {}
@@ -64,9 +89,22 @@ class EventStream(EventStore):
         self._queue_thread.daemon = True
         self._queue_thread.start()
         self._subscribers = {}
-        self._lock = threading.Lock()
+        # Reentrant: index maintenance under the lock may call back into
+        # locked helpers (get_event_index from _candidate_ids_for_filter)
+        self._lock = threading.RLock()
         self.secrets = {}
         self._write_page_cache = []
+        self.write_behind = write_behind
+        self.flush_interval = flush_interval
+        self._pending_writes = []
+        self._in_flight_writes = []
+        self._flush_in_progress = False
+        self._write_cond = threading.Condition()
+        self._flusher_thread: threading.Thread | None = None
+        if write_behind:
+            self._flusher_thread = threading.Thread(target=self._run_flush_loop)
+            self._flusher_thread.daemon = True
+            self._flusher_thread.start()
 
     def _init_thread_loop(self, subscriber_id: str, callback_id: str) -> None:
         loop = asyncio.new_event_loop()
@@ -76,7 +114,17 @@ class EventStream(EventStore):
         self._thread_loops[subscriber_id][callback_id] = loop
 
     def close(self) -> None:
+        self.flush()
+        if self._event_index is not None:
+            try:
+                self._event_index.save()
+            except Exception:
+                logger.warning(f'Failed to save event index for session {self.sid}')
         self._stop_flag.set()
+        with self._write_cond:
+            self._write_cond.notify_all()
+        if self._flusher_thread is not None and self._flusher_thread.is_alive():
+            self._flusher_thread.join()
         if self._queue_thread.is_alive():
             self._queue_thread.join()
 
@@ -183,24 +231,125 @@ class EventStream(EventStore):
             if len(current_write_page) == self.cache_size:
                 self._write_page_cache = []
 
-        if event.id is not None:
+            if self._event_index is not None and event.id is not None:
+                # Keep the search index fresh once it has been materialized
+                self._event_index.ingest(event.id, data)
+                self._event_index.maybe_save()
+
+            if event.id is not None and self.write_behind:
+                # Enqueue under the lock so the flusher sees events in id
+                # order; the actual write happens off the hot path.
+                self._ensure_flusher()
+                with self._write_cond:
+                    self._pending_writes.append((event.id, data, current_write_page))
+                    self._write_cond.notify_all()
+            elif self.use_event_log and event.id is not None:
+                # Append under the lock so segment writes stay in id order.
+                # Segments double as cache pages, so no separate page write.
+                self.event_log.append(event.id, data)
+
+        if event.id is not None and not self.write_behind:
             # Write the event to the store - this can take some time
-            event_json = json.dumps(data)
-            filename = self._get_filename_for_id(event.id, self.user_id)
-            if len(event_json) > 1_000_000:  # Roughly 1MB in bytes, ignoring encoding
-                logger.warning(
-                    f'Saving event JSON over 1MB: {len(event_json):,} bytes, filename: {filename}',
-                    extra={
-                        'user_id': self.user_id,
-                        'session_id': self.sid,
-                        'size': len(event_json),
-                    },
-                )
+            self._write_event(event.id, data, current_write_page)
+        self._queue.put(event)
+
+    def _write_event(
+        self, event_id: int, data: dict, current_write_page: list[dict]
+    ) -> None:
+        event_json = json.dumps(data)
+        filename = self._get_filename_for_id(event_id, self.user_id)
+        if len(event_json) > 1_000_000:  # Roughly 1MB in bytes, ignoring encoding
+            logger.warning(
+                f'Saving event JSON over 1MB: {len(event_json):,} bytes, filename: {filename}',
+                extra={
+                    'user_id': self.user_id,
+                    'session_id': self.sid,
+                    'size': len(event_json),
+                },
+            )
+        if not self.use_event_log:
             self.file_store.write(filename, event_json)
 
             # Store the cache page last - if it is not present during reads then it will simply be bypassed.
             self._store_cache_page(current_write_page)
-        self._queue.put(event)
+
+    def _ensure_flusher(self) -> None:
+        """Start the flusher thread if write-behind was enabled after init."""
+        if self._flusher_thread is None:
+            self._flusher_thread = threading.Thread(target=self._run_flush_loop)
+            self._flusher_thread.daemon = True
+            self._flusher_thread.start()
+
+    def _run_flush_loop(self) -> None:
+        while True:
+            with self._write_cond:
+                if not self._pending_writes:
+                    if self._stop_flag.is_set() or not should_continue():
+                        return
+                    self._write_cond.wait(timeout=self.flush_interval)
+                batch = self._pending_writes
+                self._pending_writes = []
+                self._in_flight_writes = batch
+                self._flush_in_progress = bool(batch)
+            if batch:
+                try:
+                    self._flush_batch(batch)
+                except Exception:
+                    logger.exception(
+                        f'Error flushing {len(batch)} events for session {self.sid}',
+                        extra={'session_id': self.sid, 'user_id': self.user_id},
+                    )
+                finally:
+                    with self._write_cond:
+                        self._in_flight_writes = []
+                        self._flush_in_progress = False
+                        self._write_cond.notify_all()
+
+    def _flush_batch(self, batch: list[tuple[int, dict, list[dict]]]) -> None:
+        """Group commit a batch of events accumulated by the write-behind queue.
+
+        With the segmented log each touched segment is written once for the
+        whole batch; with the per-event layout each event file is still
+        written, but cache pages are stored once per completed page.
+        """
+        if self.use_event_log:
+            self.event_log.append_batch(
+                [(event_id, data) for event_id, data, _ in batch]
+            )
+            return
+        pages: dict[int, list[dict]] = {}
+        for event_id, data, current_write_page in batch:
+            self._write_event(event_id, data, [])
+            pages[id(current_write_page)] = current_write_page
+        for current_write_page in pages.values():
+            self._store_cache_page(current_write_page)
+
+    def flush(self) -> None:
+        """Block until every queued event has been written to the file store.
+
+        This is the durability point for write-behind streams; it is a no-op
+        when write-behind is disabled because writes are then synchronous.
+        """
+        if not self.write_behind:
+            return
+        with self._write_cond:
+            self._write_cond.notify_all()
+            while self._pending_writes or self._flush_in_progress:
+                if self._flusher_thread is None or not self._flusher_thread.is_alive():
+                    # The flusher exited (e.g. shutdown) - drain synchronously
+                    # rather than waiting forever.
+                    batch = self._in_flight_writes + self._pending_writes
+                    self._pending_writes = []
+                    self._in_flight_writes = []
+                    try:
+                        self._flush_batch(batch)
+                    except Exception:
+                        logger.exception(
+                            f'Error draining {len(batch)} events for session {self.sid}',
+                            extra={'session_id': self.sid, 'user_id': self.user_id},
+                        )
+                    return
+                self._write_cond.wait(timeout=0.05)
 
     def _store_cache_page(self, current_write_page: list[dict]):
         """Store a page in the cache. Reading individual events is slow when there are a lot of them, so we use pages."""
@@ -212,6 +361,28 @@ class EventStream(EventStore):
         cache_filename = self._get_filename_for_cache(start, end)
         self.file_store.write(cache_filename, contents)
 
+    def get_event_index(self):
+        # Guard the catch-up scan against concurrent add_event ingestion:
+        # an in-flight id must not be recorded as missing
+        with self._lock:
+            return super().get_event_index()
+
+    def _candidate_ids_for_filter(self, filter, start_id, end_id, reverse):
+        # Guard the index against concurrent add_event ingestion
+        with self._lock:
+            return super()._candidate_ids_for_filter(filter, start_id, end_id, reverse)
+
+    def _get_event_data(self, id: int) -> dict:
+        if self.write_behind:
+            # The event may still be sitting in the write-behind queue or in
+            # the batch currently being flushed.
+            with self._write_cond:
+                queued = self._in_flight_writes + self._pending_writes
+            for event_id, data, _ in reversed(queued):
+                if event_id == id:
+                    return data
+        return super()._get_event_data(id)
+
     def set_secrets(self, secrets: dict[str, str]) -> None:
         self.secrets = secrets.copy()
 
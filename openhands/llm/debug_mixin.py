@@ -4,7 +4,7 @@ from typing import Any
 from litellm import ChatCompletionMessageToolCall
 from litellm.types.utils import ModelResponse
 
-from openhands.core.logger import llm_prompt_logger, llm_response_logger
+from openhands.core.logger import LazyStr, llm_prompt_logger, llm_response_logger
 from openhands.core.logger import openhands_logger as logger
 
 MESSAGE_SEPARATOR = '\n\n----------\n\n'
@@ -20,33 +20,39 @@ class DebugMixin:
             return
 
         messages = messages if isinstance(messages, list) else [messages]
-        debug_message = MESSAGE_SEPARATOR.join(
-            self._format_message_content(msg)
-            for msg in messages
-            if msg['content'] is not None
-        )
 
-        if debug_message:
-            llm_prompt_logger.debug(debug_message)
-        else:
-            logger.debug('No completion messages!')
+        def build_debug_message() -> str:
+            return MESSAGE_SEPARATOR.join(
+                self._format_message_content(msg)
+                for msg in messages
+                if msg['content'] is not None
+            ) or 'No completion messages!'
+
+        # LazyStr defers assembling the (large) prompt string until the
+        # record actually passes the level and sampling filters
+        llm_prompt_logger.debug(
+            '%s', LazyStr(build_debug_message), extra={'sample_category': 'llm'}
+        )
 
     def log_response(self, resp: ModelResponse) -> None:
         if not logger.isEnabledFor(DEBUG):
             # Don't use memory building message string if not logging.
             return
-        message_back: str = resp['choices'][0]['message']['content'] or ''
-        tool_calls: list[ChatCompletionMessageToolCall] = resp['choices'][0][
-            'message'
-        ].get('tool_calls', [])
-        if tool_calls:
-            for tool_call in tool_calls:
-                fn_name = tool_call.function.name
-                fn_args = tool_call.function.arguments
-                message_back += f'\nFunction call: {fn_name}({fn_args})'
+        def build_message_back() -> str:
+            message_back: str = resp['choices'][0]['message']['content'] or ''
+            tool_calls: list[ChatCompletionMessageToolCall] = resp['choices'][0][
+                'message'
+            ].get('tool_calls', [])
+            if tool_calls:
+                for tool_call in tool_calls:
+                    fn_name = tool_call.function.name
+                    fn_args = tool_call.function.arguments
+                    message_back += f'\nFunction call: {fn_name}({fn_args})'
+            return message_back
 
-        if message_back:
-            llm_response_logger.debug(message_back)
+        llm_response_logger.debug(
+            '%s', LazyStr(build_message_back), extra={'sample_category': 'llm'}
+        )
 
     def _format_message_content(self, message: dict[str, Any]) -> str:
         content = message['content']
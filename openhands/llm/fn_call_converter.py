@@ -10,6 +10,7 @@ import copy
 import json
 import re
 import sys
+from collections import OrderedDict
 from typing import Iterable
 
 from litellm import ChatCompletionToolParam
@@ -401,6 +402,31 @@ FN_PARAM_REGEX_PATTERN = r'<parameter=([^>]+)>(.*?)</parameter>'
 # Add new regex pattern for tool execution results
 TOOL_RESULT_REGEX_PATTERN = r'EXECUTION RESULT of \[(.*?)\]:\n(.*)'
 
+# Precompiled forms of the patterns above - compiled once per process instead
+# of once per message conversion
+FN_REGEX = re.compile(FN_REGEX_PATTERN, re.DOTALL)
+FN_PARAM_REGEX = re.compile(FN_PARAM_REGEX_PATTERN, re.DOTALL)
+TOOL_RESULT_REGEX = re.compile(TOOL_RESULT_REGEX_PATTERN, re.DOTALL)
+PARAM_TAG_NORMALIZER_REGEX = re.compile(
+    r'<parameter=([a-zA-Z0-9_]+)=([^<]*)</parameter>'
+)
+
+# Per-message conversion cache: a mostly-unchanged message prefix is converted
+# once per conversation lifetime instead of on every completion
+_CONVERSION_CACHE: OrderedDict[tuple, dict] = OrderedDict()
+_CONVERSION_CACHE_SIZE = 1024
+
+
+def _conversion_cache_key(
+    message: dict, tools_key: int, gets_example: bool
+) -> tuple | None:
+    """Content-hash key for one converted message, or None if unhashable."""
+    try:
+        payload = json.dumps(message, sort_keys=True, default=str)
+    except (TypeError, ValueError):
+        return None
+    return (hash(payload), tools_key, gets_example)
+
 
 def convert_tool_call_to_string(tool_call: dict) -> str:
     """Convert tool call to content in string format."""
@@ -476,18 +502,42 @@ def convert_fncall_messages_to_non_fncall_messages(
     tools: list[ChatCompletionToolParam],
     add_in_context_learning_example: bool = True,
 ) -> list[dict]:
-    """Convert function calling messages to non-function calling messages."""
-    messages = copy.deepcopy(messages)
+    """Convert function calling messages to non-function calling messages.
 
+    Conversion results are cached per message (keyed by content hash and the
+    tool set), so mostly-unchanged history prefixes are converted once per
+    conversation lifetime instead of on every completion.
+    """
     formatted_tools = convert_tools_to_description(tools)
     system_prompt_suffix = SYSTEM_PROMPT_SUFFIX_TEMPLATE.format(
         description=formatted_tools
     )
+    try:
+        tools_key = hash(json.dumps(tools, sort_keys=True, default=str))
+    except (TypeError, ValueError):
+        tools_key = 0
 
     converted_messages = []
     first_user_message_encountered = False
-    for message in messages:
-        role = message['role']
+    for original_message in messages:
+        role = original_message['role']
+        gets_example = (
+            role == 'user'
+            and not first_user_message_encountered
+            and add_in_context_learning_example
+        )
+        cache_key = _conversion_cache_key(original_message, tools_key, gets_example)
+        if cache_key is not None:
+            cached = _CONVERSION_CACHE.get(cache_key)
+            if cached is not None:
+                _CONVERSION_CACHE.move_to_end(cache_key)
+                if role == 'user':
+                    first_user_message_encountered = True
+                converted_messages.append(copy.deepcopy(cached))
+                continue
+
+        # The per-role conversion below mutates content in place
+        message = copy.deepcopy(original_message)
         content = message['content']
 
         # 1. SYSTEM MESSAGES
@@ -612,6 +662,11 @@ def convert_fncall_messages_to_non_fncall_messages(
             raise FunctionCallConversionError(
                 f'Unexpected role {role}. Expected system, user, assistant or tool.'
             )
+
+        if cache_key is not None:
+            _CONVERSION_CACHE[cache_key] = copy.deepcopy(converted_messages[-1])
+            if len(_CONVERSION_CACHE) > _CONVERSION_CACHE_SIZE:
+                _CONVERSION_CACHE.popitem(last=False)
     return converted_messages
 
 
@@ -713,8 +768,7 @@ def _normalize_parameter_tags(fn_body: str) -> str:
     downstream parsing to succeed.
     """
     # Replace '<parameter=name=value</parameter>' with '<parameter=name>value</parameter>'
-    return re.sub(
-        r'<parameter=([a-zA-Z0-9_]+)=([^<]*)</parameter>',
+    return PARAM_TAG_NORMALIZER_REGEX.sub(
         r'<parameter=\1>\2</parameter>',
         fn_body,
     )
@@ -785,9 +839,7 @@ def convert_non_fncall_messages_to_fncall_messages(
 
             # Check for tool execution result pattern
             if isinstance(content, str):
-                tool_result_match = re.search(
-                    TOOL_RESULT_REGEX_PATTERN, content, re.DOTALL
-                )
+                tool_result_match = TOOL_RESULT_REGEX.search(content)
             elif isinstance(content, list):
                 tool_result_match = next(
                     (
@@ -795,9 +847,7 @@ def convert_non_fncall_messages_to_fncall_messages(
                         for item in content
                         if item.get('type') == 'text'
                         and (
-                            _match := re.search(
-                                TOOL_RESULT_REGEX_PATTERN, item['text'], re.DOTALL
-                            )
+                            _match := TOOL_RESULT_REGEX.search(item['text'])
                         )
                     ),
                     None,
@@ -842,18 +892,16 @@ def convert_non_fncall_messages_to_fncall_messages(
         elif role == 'assistant':
             if isinstance(content, str):
                 content = _fix_stopword(content)
-                fn_match = re.search(FN_REGEX_PATTERN, content, re.DOTALL)
+                fn_match = FN_REGEX.search(content)
             elif isinstance(content, list):
                 if content and content[-1]['type'] == 'text':
                     content[-1]['text'] = _fix_stopword(content[-1]['text'])
-                    fn_match = re.search(
-                        FN_REGEX_PATTERN, content[-1]['text'], re.DOTALL
-                    )
+                    fn_match = FN_REGEX.search(content[-1]['text'])
                 else:
                     fn_match = None
                 fn_match_exists = any(
                     item.get('type') == 'text'
-                    and re.search(FN_REGEX_PATTERN, item['text'], re.DOTALL)
+                    and FN_REGEX.search(item['text'])
                     for item in content
                 )
                 if fn_match_exists and not fn_match:
@@ -884,7 +932,7 @@ def convert_non_fncall_messages_to_fncall_messages(
                     )
 
                 # Parse parameters
-                param_matches = re.finditer(FN_PARAM_REGEX_PATTERN, fn_body, re.DOTALL)
+                param_matches = FN_PARAM_REGEX.finditer(fn_body)
                 params = _extract_and_validate_params(
                     matching_tool, param_matches, fn_name
                 )
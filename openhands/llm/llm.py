@@ -1,7 +1,9 @@
 import copy
+import json
 import os
 import time
 import warnings
+from collections import OrderedDict
 from functools import partial
 from typing import Any, Callable, cast
 
@@ -58,6 +60,11 @@ class LLM(RetryMixin, DebugMixin):
         config: an LLMConfig object specifying the configuration of the LLM.
     """
 
+    # Max entries in the per-message token count cache. A long conversation
+    # re-counts the same messages every step, so this only needs to cover the
+    # working set of one context window.
+    TOKEN_COUNT_CACHE_SIZE = 2048
+
     def __init__(
         self,
         config: LLMConfig,
@@ -109,6 +116,10 @@ class LLM(RetryMixin, DebugMixin):
         else:
             self.tokenizer = None
 
+        # Per-message token count cache so repeated context-window accounting
+        # only tokenizes messages added since the last call.
+        self._token_count_cache: OrderedDict[int, int] = OrderedDict()
+
         # set up the completion function
         kwargs: dict[str, Any] = {
             'temperature': self.config.temperature,
@@ -708,15 +719,29 @@ class LLM(RetryMixin, DebugMixin):
             messages = self.format_messages_for_llm(messages_typed)
 
         # try to get the token count with the default litellm tokenizers
-        # or the custom tokenizer if set for this LLM configuration
+        # or the custom tokenizer if set for this LLM configuration.
+        # Counts are cached per message (keyed by content hash), so only
+        # messages not seen before are actually tokenized.
         try:
-            return int(
-                litellm.token_counter(
-                    model=self.config.model,
-                    messages=messages,
-                    custom_tokenizer=self.tokenizer,
-                )
-            )
+            total = 0
+            for message in messages:
+                key = hash(json.dumps(message, sort_keys=True, default=str))
+                count = self._token_count_cache.get(key)
+                if count is None:
+                    count = int(
+                        litellm.token_counter(
+                            model=self.config.model,
+                            messages=[message],
+                            custom_tokenizer=self.tokenizer,
+                        )
+                    )
+                    self._token_count_cache[key] = count
+                    if len(self._token_count_cache) > self.TOKEN_COUNT_CACHE_SIZE:
+                        self._token_count_cache.popitem(last=False)
+                else:
+                    self._token_count_cache.move_to_end(key)
+                total += count
+            return total
         except Exception as e:
             # limit logspam in case token count is not supported
             logger.error(
@@ -729,6 +754,14 @@ class LLM(RetryMixin, DebugMixin):
             )
             return 0
 
+    def invalidate_token_count_cache(self) -> None:
+        """Drop all cached per-message token counts.
+
+        Must be called when the model (and therefore the tokenizer) changes,
+        e.g. on a model switch in LLMRegistry.
+        """
+        self._token_count_cache.clear()
+
     def _is_local(self) -> bool:
         """Determines if the system is using a locally running LLM.
 
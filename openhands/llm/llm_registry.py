@@ -51,6 +51,11 @@ class LLMRegistry:
             )
         else:
             llm = LLM(service_id=service_id, config=config)
+        existing = self.service_to_llm.get(service_id)
+        if existing is not None:
+            # The service is switching models - stale per-message token counts
+            # must not leak into accounting done through old references.
+            existing.invalidate_token_count_cache()
         self.service_to_llm[service_id] = llm
         self.notify(RegistryEvent(llm=llm, service_id=service_id))
         return llm
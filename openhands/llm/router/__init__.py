@@ -1,8 +1,10 @@
+from openhands.llm.router.adaptive.impl import AdaptiveRouter
 from openhands.llm.router.base import ROUTER_LLM_REGISTRY, RouterLLM
 from openhands.llm.router.rule_based.impl import MultimodalRouter
 
 __all__ = [
     'RouterLLM',
     'ROUTER_LLM_REGISTRY',
+    'AdaptiveRouter',
     'MultimodalRouter',
 ]
@@ -0,0 +1,173 @@
+import time
+from collections import deque
+from dataclasses import dataclass, field
+
+from openhands.core.config import AgentConfig
+from openhands.core.logger import openhands_logger as logger
+from openhands.core.message import Message
+from openhands.llm.llm_registry import LLMRegistry
+from openhands.llm.router.base import ROUTER_LLM_REGISTRY, RouterLLM
+
+
+@dataclass
+class EndpointStats:
+    """Rolling health/latency/cost statistics for one routed endpoint."""
+
+    latencies: deque = field(default_factory=lambda: deque(maxlen=20))
+    costs: deque = field(default_factory=lambda: deque(maxlen=20))
+    consumed_latencies: int = 0
+    consumed_costs: int = 0
+    consecutive_failures: int = 0
+    cooldown_until: float = 0.0
+
+    def percentile(self, fraction: float) -> float | None:
+        if not self.latencies:
+            return None
+        ordered = sorted(self.latencies)
+        index = min(len(ordered) - 1, int(fraction * len(ordered)))
+        return ordered[index]
+
+    @property
+    def p50(self) -> float | None:
+        return self.percentile(0.5)
+
+    @property
+    def p95(self) -> float | None:
+        return self.percentile(0.95)
+
+    @property
+    def avg_cost(self) -> float:
+        if not self.costs:
+            return 0.0
+        return sum(self.costs) / len(self.costs)
+
+    def healthy(self, now: float) -> bool:
+        return now >= self.cooldown_until
+
+
+class AdaptiveRouter(RouterLLM):
+    """Routes each completion to the currently fastest/cheapest healthy endpoint.
+
+    Per endpoint, the router keeps rolling p50/p95 latency and cost pulled
+    from the metrics every LLM instance already accumulates, plus an error
+    cooldown with exponential backoff fed by completion failures (throttling
+    surfaces here as terminal retry errors and as inflated latency). Traffic
+    shifts only when a challenger beats the current endpoint's score by the
+    hysteresis margin, so providers trading places by a few percent do not
+    cause flapping, while a brownout on the active endpoint fails over
+    transparently on the next call.
+    """
+
+    ROUTER_NAME = 'adaptive_router'
+
+    # Hysteresis: a challenger must beat the current endpoint's score by this
+    # factor before traffic shifts
+    HYSTERESIS_FACTOR = 0.8
+    # How many seconds of latency one dollar of per-call cost is worth
+    COST_WEIGHT_SECONDS_PER_DOLLAR = 10.0
+    # Error cooldown backoff
+    BASE_COOLDOWN_SECONDS = 30.0
+    MAX_COOLDOWN_SECONDS = 300.0
+
+    def __init__(
+        self,
+        agent_config: AgentConfig,
+        llm_registry: LLMRegistry,
+        **kwargs,
+    ):
+        super().__init__(agent_config, llm_registry, **kwargs)
+        self._stats: dict[str, EndpointStats] = {
+            key: EndpointStats() for key in self.available_llms
+        }
+
+    def _refresh_stats(self) -> None:
+        """Pull new latency/cost samples from each endpoint's metrics."""
+        for key, llm in self.available_llms.items():
+            stats = self._stats[key]
+            latencies = llm.metrics.response_latencies
+            for entry in latencies[stats.consumed_latencies :]:
+                stats.latencies.append(entry.latency)
+            stats.consumed_latencies = len(latencies)
+            costs = llm.metrics.costs
+            for entry in costs[stats.consumed_costs :]:
+                stats.costs.append(entry.cost)
+            stats.consumed_costs = len(costs)
+
+    def _score(self, stats: EndpointStats) -> float:
+        """Lower is better; endpoints without samples score optimistically."""
+        p95 = stats.p95
+        if p95 is None:
+            return 0.0
+        return p95 + stats.avg_cost * self.COST_WEIGHT_SECONDS_PER_DOLLAR
+
+    def _select_llm(self, messages: list[Message]) -> str:
+        self._refresh_stats()
+        now = time.time()
+        healthy = {
+            key: stats for key, stats in self._stats.items() if stats.healthy(now)
+        }
+        if not healthy:
+            # Everything is cooling down - take whatever recovers first
+            key = min(self._stats, key=lambda k: self._stats[k].cooldown_until)
+            logger.warning(
+                f'All routed endpoints are cooling down; using {key} as least-bad'
+            )
+            return key
+
+        current = self._last_routing_decision
+        best = min(healthy, key=lambda k: self._score(healthy[k]))
+        if current in healthy:
+            current_score = self._score(healthy[current])
+            best_score = self._score(healthy[best])
+            # Hysteresis: only shift when the challenger is clearly better
+            if best != current and best_score >= current_score * self.HYSTERESIS_FACTOR:
+                return current
+        if best != current:
+            logger.info(
+                f'AdaptiveRouter shifting traffic from {current} to {best} '
+                f'(score {self._score(healthy[best]):.3f})'
+            )
+        return best
+
+    @property
+    def completion(self):
+        route = super().completion
+
+        def adaptive_completion(*args, **kwargs):
+            try:
+                response = route(*args, **kwargs)
+            except Exception:
+                self._record_failure(self._last_routing_decision)
+                raise
+            self._record_success(self._last_routing_decision)
+            return response
+
+        return adaptive_completion
+
+    def _record_success(self, key: str) -> None:
+        stats = self._stats.get(key)
+        if stats is None:
+            return
+        stats.consecutive_failures = 0
+        stats.cooldown_until = 0.0
+
+    def _record_failure(self, key: str) -> None:
+        """A terminal completion failure (retries exhausted, auth, throttling)
+        puts the endpoint on an exponential cooldown."""
+        stats = self._stats.get(key)
+        if stats is None:
+            return
+        stats.consecutive_failures += 1
+        cooldown = min(
+            self.BASE_COOLDOWN_SECONDS * (2 ** (stats.consecutive_failures - 1)),
+            self.MAX_COOLDOWN_SECONDS,
+        )
+        stats.cooldown_until = time.time() + cooldown
+        logger.warning(
+            f'Endpoint {key} failed {stats.consecutive_failures}x; '
+            f'cooling down for {cooldown:.0f}s'
+        )
+
+
+# Register the router
+ROUTER_LLM_REGISTRY[AdaptiveRouter.ROUTER_NAME] = AdaptiveRouter
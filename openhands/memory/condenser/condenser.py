@@ -1,6 +1,7 @@
 from __future__ import annotations
 
 from abc import ABC, abstractmethod
+from concurrent.futures import Future, ThreadPoolExecutor
 from contextlib import contextmanager
 from typing import Any
 
@@ -172,8 +173,17 @@ class RollingCondenser(Condenser, ABC):
     The rolling history is generated by `View.from_events`, which analyzes all events in the history and produces a `View` object representing what will be sent to the LLM.
 
     If `should_condense` says so, the condenser is then responsible for generating a `Condensation` object from the `View` object. This will be added to the event history which should -- when given to `get_view` -- produce the condensed `View` to be passed to the LLM.
+
+    When pipelining is enabled (`enable_pipelining`), the condenser speculatively starts `get_condensation` in a background thread once `should_precondense` fires -- before `should_condense` would block the step -- so the `Condensation` is usually already available by the time it is needed.
     """
 
+    PRE_CONDENSE_WATERMARK = 0.75
+    """Fraction of `max_size` at which a speculative condensation is started."""
+
+    enable_pipelining: bool = False
+    _speculative_future: Future[Condensation] | None = None
+    _speculation_executor: ThreadPoolExecutor | None = None
+
     @abstractmethod
     def should_condense(self, view: View) -> bool:
         """Determine if a view should be condensed."""
@@ -182,12 +192,80 @@ class RollingCondenser(Condenser, ABC):
     def get_condensation(self, view: View) -> Condensation:
         """Get the condensation from a view."""
 
+    def should_precondense(self, view: View) -> bool:
+        """Determine if a speculative condensation should be started.
+
+        The default implementation fires once the view crosses
+        `PRE_CONDENSE_WATERMARK` of the condenser's `max_size`, for condensers
+        that have one. Subclasses with different thresholds can override this.
+        """
+        if not self.enable_pipelining:
+            return False
+        max_size = getattr(self, 'max_size', None)
+        if max_size is None:
+            return False
+        return len(view) > int(max_size * self.PRE_CONDENSE_WATERMARK)
+
+    def _start_speculative_condensation(self, view: View) -> None:
+        """Kick off `get_condensation` in the background for a future step.
+
+        A speculation that is still running, or that completed and is still
+        usable for the current view, is kept rather than restarted - one
+        summarization per condensation cycle, not one per step.
+        """
+        future = self._speculative_future
+        if future is not None:
+            if not future.done():
+                return
+            if future.exception() is None:
+                view_ids = {event.id for event in view}
+                if set(future.result().action.forgotten).issubset(view_ids):
+                    return
+        if self._speculation_executor is None:
+            self._speculation_executor = ThreadPoolExecutor(
+                max_workers=1, thread_name_prefix='condenser-speculation'
+            )
+        self._speculative_future = self._speculation_executor.submit(
+            self.get_condensation, view
+        )
+
+    def _take_speculative_condensation(self, view: View) -> Condensation | None:
+        """Consume the speculative result if it is still valid for this view.
+
+        Returns None (and leaves the caller to condense synchronously) if no
+        speculation was started, it failed, or the history changed underneath
+        it so that some of the events it forgets are already gone.
+        """
+        future = self._speculative_future
+        if future is None:
+            return None
+        self._speculative_future = None
+        try:
+            # If the speculation is still in flight this blocks, which is
+            # still a head start over condensing from scratch.
+            condensation = future.result()
+        except Exception:
+            logger.warning(
+                'Speculative condensation failed; condensing synchronously',
+                exc_info=True,
+            )
+            return None
+        view_ids = {event.id for event in view}
+        if not set(condensation.action.forgotten).issubset(view_ids):
+            return None
+        return condensation
+
     def condense(self, view: View) -> View | Condensation:
         # If we trigger the condenser-specific condensation threshold, compute and return
-        # the condensation.
+        # the condensation - reusing the speculative result when one is ready.
         if self.should_condense(view):
-            return self.get_condensation(view)
+            condensation = self._take_speculative_condensation(view)
+            if condensation is None:
+                condensation = self.get_condensation(view)
+            return condensation
+
+        if self.should_precondense(view):
+            self._start_speculative_condensation(view)
 
         # Otherwise we're safe to just return the view.
-        else:
-            return view
+        return view
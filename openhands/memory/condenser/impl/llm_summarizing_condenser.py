@@ -28,6 +28,7 @@ class LLMSummarizingCondenser(RollingCondenser):
         max_size: int = 100,
         keep_first: int = 1,
         max_event_length: int = 10_000,
+        enable_pipelining: bool = False,
     ):
         if keep_first >= max_size // 2:
             raise ValueError(
@@ -41,6 +42,7 @@ class LLMSummarizingCondenser(RollingCondenser):
         self.max_size = max_size
         self.keep_first = keep_first
         self.max_event_length = max_event_length
+        self.enable_pipelining = enable_pipelining
         self.llm = llm
 
         super().__init__()
@@ -176,6 +178,7 @@ CURRENT_STATE: Last flip: Heads, Haiku count: 15/20"""
             max_size=config.max_size,
             keep_first=config.keep_first,
             max_event_length=config.max_event_length,
+            enable_pipelining=config.enable_pipelining,
         )
 
 
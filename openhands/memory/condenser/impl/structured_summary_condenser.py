@@ -171,6 +171,7 @@ class StructuredSummaryCondenser(RollingCondenser):
         max_size: int = 100,
         keep_first: int = 1,
         max_event_length: int = 10_000,
+        enable_pipelining: bool = False,
     ):
         if keep_first >= max_size // 2:
             raise ValueError(
@@ -184,6 +185,7 @@ class StructuredSummaryCondenser(RollingCondenser):
         self.max_size = max_size
         self.keep_first = keep_first
         self.max_event_length = max_event_length
+        self.enable_pipelining = enable_pipelining
         self.llm = llm
         if not self.llm.is_function_calling_active():
             raise ValueError(
@@ -323,6 +325,7 @@ Capture all relevant information, especially:
             max_size=config.max_size,
             keep_first=config.keep_first,
             max_event_length=config.max_event_length,
+            enable_pipelining=config.enable_pipelining,
         )
 
 
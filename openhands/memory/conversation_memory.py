@@ -59,6 +59,21 @@ class ConversationMemory:
     def __init__(self, config: AgentConfig, prompt_manager: PromptManager):
         self.agent_config = config
         self.prompt_manager = prompt_manager
+        # Incremental conversion cache: converted messages and in-progress tool
+        # call state for the event prefix identified by _cached_event_keys.
+        # None means the cache is empty or was invalidated.
+        self._cached_event_keys: list | None = None
+        self._cached_messages: list[Message] = []
+        self._cached_pending_tool_calls: dict[str, Message] = {}
+        self._cached_tool_call_id_to_message: dict[str, Message] = {}
+        # Conversion parameters the cached messages were built with - a change
+        # in either alters per-event conversion, so the cache must drop
+        self._cached_conversion_params: tuple | None = None
+
+    @staticmethod
+    def _event_cache_key(event: Event) -> tuple:
+        """Key identifying an event in the incremental conversion cache."""
+        return (event.id, type(event).__name__)
 
     @staticmethod
     def _is_valid_image_url(url: str | None) -> bool:
@@ -99,14 +114,39 @@ class ConversationMemory:
         # log visual browsing status
         logger.debug(f'Visual browsing: {self.agent_config.enable_som_visual_browsing}')
 
-        # Initialize empty messages list
-        messages = []
-
-        # Process regular events
-        pending_tool_call_action_messages: dict[str, Message] = {}
-        tool_call_id_to_message: dict[str, Message] = {}
-
-        for i, event in enumerate(events):
+        # Per-event conversion is deterministic and only depends on the event
+        # and the events before it, so when the new history extends the cached
+        # prefix we only convert the delta. A condensation rewrites the prefix
+        # and therefore drops the cache.
+        event_keys = [self._event_cache_key(event) for event in events]
+        # Synthetic events (the legacy system message / initial user message
+        # inserts) have no id, so a history containing them cannot be keyed
+        # reliably - fall back to full conversion.
+        incremental = self.agent_config.enable_incremental_memory and all(
+            event.id != Event.INVALID_ID for event in events
+        )
+        conversion_params = (max_message_chars, vision_is_active)
+        if (
+            incremental
+            and self._cached_event_keys is not None
+            and self._cached_conversion_params == conversion_params
+            and len(event_keys) >= len(self._cached_event_keys)
+            and event_keys[: len(self._cached_event_keys)] == self._cached_event_keys
+        ):
+            start_index = len(self._cached_event_keys)
+            messages = self._cached_messages
+            pending_tool_call_action_messages = self._cached_pending_tool_calls
+            tool_call_id_to_message = self._cached_tool_call_id_to_message
+        else:
+            start_index = 0
+            messages = []
+            pending_tool_call_action_messages = {}
+            tool_call_id_to_message = {}
+        # Invalidate while mutating so a failed conversion can't leave a
+        # half-updated cache behind.
+        self._cached_event_keys = None
+
+        for i, event in enumerate(events[start_index:], start=start_index):
             # create a regular message from an event
             if isinstance(event, Action):
                 messages_to_add = self._process_action(
@@ -155,6 +195,13 @@ class ConversationMemory:
 
             messages += messages_to_add
 
+        if incremental:
+            self._cached_event_keys = event_keys
+            self._cached_messages = messages
+            self._cached_pending_tool_calls = pending_tool_call_action_messages
+            self._cached_tool_call_id_to_message = tool_call_id_to_message
+            self._cached_conversion_params = conversion_params
+
         # Apply final filtering so that the messages in context don't have unmatched tool calls
         # and tool responses, for example
         messages = list(ConversationMemory._filter_unmatched_tool_calls(messages))
@@ -171,11 +218,17 @@ class ConversationMemory:
         for msg in messages:
             # Add double newline between consecutive user messages
             if msg.role == 'user' and prev_role == 'user' and len(msg.content) > 0:
-                # Find the first TextContent in the message to add newlines
-                for content_item in msg.content:
+                # Find the first TextContent in the message to add newlines.
+                # Copy instead of mutating so the cached messages held by the
+                # incremental cache are not reformatted again on the next step.
+                for index, content_item in enumerate(msg.content):
                     if isinstance(content_item, TextContent):
                         # Prepend two newlines to ensure visual separation
-                        content_item.text = '\n\n' + content_item.text
+                        new_content = list(msg.content)
+                        new_content[index] = content_item.model_copy(
+                            update={'text': '\n\n' + content_item.text}
+                        )
+                        msg = msg.model_copy(update={'content': new_content})
                         break
             formatted_messages.append(msg)
             prev_role = msg.role  # Update prev_role after processing each message
@@ -689,6 +742,13 @@ class ConversationMemory:
 
         For new Anthropic API, we only need to mark the last user or tool message as cacheable.
         """
+        # Clear any stale breakpoints first - with the incremental cache the
+        # same Message objects are reused across steps, and the previously-last
+        # message would otherwise keep its flag forever.
+        for message in messages:
+            for content_item in message.content:
+                if content_item.cache_prompt:
+                    content_item.cache_prompt = False
         if len(messages) > 0 and messages[0].role == 'system':
             messages[0].content[-1].cache_prompt = True
         # NOTE: this is only needed for anthropic
@@ -20,6 +20,7 @@ from openhands.microagent import (
     BaseMicroagent,
     KnowledgeMicroagent,
     RepoMicroagent,
+    TriggerIndex,
     load_microagents_from_dir,
 )
 from openhands.runtime.base import Runtime
@@ -254,18 +255,22 @@ class Memory:
         if not query:
             return recalled_content
 
-        # Search for microagent triggers in the query
-        for name, microagent in self.knowledge_microagents.items():
-            trigger = microagent.match_trigger(query)
-            if trigger:
-                logger.info("Microagent '%s' triggered by keyword '%s'", name, trigger)
-                recalled_content.append(
-                    MicroagentKnowledge(
-                        name=microagent.name,
-                        trigger=trigger,
-                        content=microagent.content,
-                    )
+        # Search for microagent triggers in the query via the shared
+        # precompiled index - one scan of the query regardless of how many
+        # triggers are loaded
+        trigger_index = TriggerIndex.for_microagents(
+            self.knowledge_microagents.values()
+        )
+        for name, trigger in trigger_index.match(query):
+            microagent = self.knowledge_microagents[name]
+            logger.info("Microagent '%s' triggered by keyword '%s'", name, trigger)
+            recalled_content.append(
+                MicroagentKnowledge(
+                    name=microagent.name,
+                    trigger=trigger,
+                    content=microagent.content,
                 )
+            )
         return recalled_content
 
     def load_user_workspace_microagents(
@@ -4,6 +4,7 @@ from .microagent import (
     RepoMicroagent,
     load_microagents_from_dir,
 )
+from .trigger_index import TriggerIndex
 from .types import MicroagentMetadata, MicroagentType
 
 __all__ = [
@@ -12,5 +13,6 @@ __all__ = [
     'RepoMicroagent',
     'MicroagentMetadata',
     'MicroagentType',
+    'TriggerIndex',
     'load_microagents_from_dir',
 ]
@@ -1,5 +1,7 @@
+import hashlib
 import io
 import re
+from collections import OrderedDict
 from itertools import chain
 from pathlib import Path
 from typing import ClassVar, Union
@@ -14,6 +16,14 @@ from openhands.core.logger import openhands_logger as logger
 from openhands.microagent.types import InputMetadata, MicroagentMetadata, MicroagentType
 
 
+# Parsed microagents keyed by (path, derived name, content hash), so repeated
+# loads of unchanged files skip frontmatter parsing and validation entirely.
+# Cached instances are shared across conversations and must be treated as
+# read-only.
+_PARSED_MICROAGENT_CACHE: OrderedDict[tuple, 'BaseMicroagent'] = OrderedDict()
+_PARSED_MICROAGENT_CACHE_SIZE = 512
+
+
 class BaseMicroagent(BaseModel):
     """Base class for all microagents."""
 
@@ -90,6 +100,16 @@ class BaseMicroagent(BaseModel):
         if third_party_agent is not None:
             return third_party_agent
 
+        cache_key = (
+            str(path),
+            derived_name,
+            hashlib.sha256(file_content.encode('utf-8')).hexdigest(),
+        )
+        cached = _PARSED_MICROAGENT_CACHE.get(cache_key)
+        if cached is not None:
+            _PARSED_MICROAGENT_CACHE.move_to_end(cache_key)
+            return cached
+
         file_io = io.StringIO(file_content)
         loaded = frontmatter.load(file_io)
         content = loaded.content
@@ -162,13 +182,17 @@ class BaseMicroagent(BaseModel):
         agent_name = derived_name if derived_name is not None else metadata.name
 
         agent_class = subclass_map[inferred_type]
-        return agent_class(
+        agent = agent_class(
             name=agent_name,
             content=content,
             metadata=metadata,
             source=str(path),
             type=inferred_type,
         )
+        _PARSED_MICROAGENT_CACHE[cache_key] = agent
+        if len(_PARSED_MICROAGENT_CACHE) > _PARSED_MICROAGENT_CACHE_SIZE:
+            _PARSED_MICROAGENT_CACHE.popitem(last=False)
+        return agent
 
 
 class KnowledgeMicroagent(BaseMicroagent):
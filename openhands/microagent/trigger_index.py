@@ -0,0 +1,130 @@
+"""Precompiled multi-pattern trigger matching for knowledge microagents.
+
+With hundreds of loaded microagents, scanning every trigger of every agent
+against each user message is O(agents x triggers x message). The index builds
+one Aho-Corasick automaton over all (lowercased) triggers, so a message is
+scanned once regardless of how many triggers exist, and the compiled automaton
+is cached per trigger set and shared across conversations.
+"""
+
+from collections import OrderedDict, deque
+from typing import TYPE_CHECKING, Iterable
+
+if TYPE_CHECKING:
+    from openhands.microagent.microagent import KnowledgeMicroagent
+
+
+class _AhoCorasick:
+    """A minimal Aho-Corasick automaton over lowercase patterns."""
+
+    def __init__(self, patterns: Iterable[str]):
+        # Node 0 is the root; each node is a dict of char -> next node
+        self._goto: list[dict[str, int]] = [{}]
+        self._fail: list[int] = [0]
+        self._output: list[list[str]] = [[]]
+        for pattern in patterns:
+            self._add(pattern)
+        self._build_failure_links()
+
+    def _add(self, pattern: str) -> None:
+        node = 0
+        for char in pattern:
+            next_node = self._goto[node].get(char)
+            if next_node is None:
+                next_node = len(self._goto)
+                self._goto[node][char] = next_node
+                self._goto.append({})
+                self._fail.append(0)
+                self._output.append([])
+            node = next_node
+        self._output[node].append(pattern)
+
+    def _build_failure_links(self) -> None:
+        queue: deque[int] = deque()
+        for node in self._goto[0].values():
+            queue.append(node)
+        while queue:
+            current = queue.popleft()
+            for char, child in self._goto[current].items():
+                queue.append(child)
+                fail = self._fail[current]
+                while fail and char not in self._goto[fail]:
+                    fail = self._fail[fail]
+                self._fail[child] = self._goto[fail].get(char, 0)
+                self._output[child] = (
+                    self._output[child] + self._output[self._fail[child]]
+                )
+
+    def find(self, text: str) -> set[str]:
+        """Return every pattern that occurs in the text."""
+        matches: set[str] = set()
+        node = 0
+        for char in text:
+            while node and char not in self._goto[node]:
+                node = self._fail[node]
+            node = self._goto[node].get(char, 0)
+            if self._output[node]:
+                matches.update(self._output[node])
+        return matches
+
+
+class TriggerIndex:
+    """Maps a message to (microagent name, matched trigger) pairs.
+
+    Instances are obtained through `for_microagents`, which caches compiled
+    automatons by trigger set - conversations sharing the same microagent
+    repo reuse one index.
+    """
+
+    _cache: OrderedDict[tuple, 'TriggerIndex'] = OrderedDict()
+    _CACHE_SIZE = 8
+
+    def __init__(self, agents: Iterable['KnowledgeMicroagent']):
+        # Per agent, triggers in declaration order as (lowercase, original)
+        self._triggers_by_agent: dict[str, list[tuple[str, str]]] = {
+            agent.name: [(trigger.lower(), trigger) for trigger in agent.triggers]
+            for agent in agents
+        }
+        patterns = {
+            lowered
+            for triggers in self._triggers_by_agent.values()
+            for lowered, _ in triggers
+            if lowered
+        }
+        self._automaton = _AhoCorasick(patterns)
+
+    @classmethod
+    def for_microagents(
+        cls, agents: Iterable['KnowledgeMicroagent']
+    ) -> 'TriggerIndex':
+        agents = list(agents)
+        key = tuple(
+            (agent.name, tuple(agent.triggers)) for agent in agents
+        )
+        index = cls._cache.get(key)
+        if index is None:
+            index = cls(agents)
+            cls._cache[key] = index
+            if len(cls._cache) > cls._CACHE_SIZE:
+                cls._cache.popitem(last=False)
+        else:
+            cls._cache.move_to_end(key)
+        return index
+
+    def match(self, message: str) -> list[tuple[str, str]]:
+        """Return (agent name, matched trigger) pairs for the message.
+
+        Agents appear in their registration order; per agent, the first
+        matching trigger in its declaration order is returned - the same
+        semantics as KnowledgeMicroagent.match_trigger.
+        """
+        matched_patterns = self._automaton.find(message.lower())
+        if not matched_patterns:
+            return []
+        results: list[tuple[str, str]] = []
+        for agent_name, triggers in self._triggers_by_agent.items():
+            for lowered, original in triggers:
+                if lowered in matched_patterns:
+                    results.append((agent_name, original))
+                    break
+        return results
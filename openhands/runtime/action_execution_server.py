@@ -20,7 +20,7 @@ from zipfile import ZipFile
 
 import puremagic
 from binaryornot.check import is_binary
-from fastapi import Depends, FastAPI, HTTPException, Request, UploadFile
+from fastapi import Depends, FastAPI, HTTPException, Request, Response, UploadFile
 from fastapi.exceptions import RequestValidationError
 from fastapi.responses import FileResponse, JSONResponse
 from fastapi.security import APIKeyHeader
@@ -68,8 +68,9 @@ from openhands.runtime.mcp.proxy import MCPProxyManager
 from openhands.runtime.plugins import ALL_PLUGINS, JupyterPlugin, Plugin, VSCodePlugin
 from openhands.runtime.utils import find_available_tcp_port
 from openhands.runtime.utils.bash import BashSession
+from openhands.runtime.utils.download_transfers import DownloadTransfers, RangeError
 from openhands.runtime.utils.files import insert_lines, read_lines
-from openhands.runtime.utils.memory_monitor import MemoryMonitor
+from openhands.runtime.utils.memory_monitor import MemoryMonitor, ResourceGovernor
 from openhands.runtime.utils.runtime_init import init_user_and_working_directory
 from openhands.runtime.utils.system_stats import (
     get_system_stats,
@@ -221,6 +222,9 @@ class ActionExecutor:
             in ['true', '1', 'yes']
         )
         self.memory_monitor.start_monitoring()
+        self.resource_governor = ResourceGovernor(
+            spill_dir=os.path.join(self._initial_cwd, '.spilled_outputs')
+        )
 
     @property
     def initial_cwd(self):
@@ -377,10 +381,13 @@ class ActionExecutor:
         logger.debug('Bash init commands completed')
 
     async def run_action(self, action) -> Observation:
+        # Hold new actions back while the sandbox is under memory pressure
+        await self.resource_governor.throttle()
         async with self.lock:
             action_type = action.action
             observation = await getattr(self, action_type)(action)
-            return observation
+            # Spill oversized output to disk, keeping an excerpt + reference
+            return self.resource_governor.govern_observation(observation)
 
     async def run(
         self, action: CmdRunAction
@@ -796,6 +803,40 @@ if __name__ == '__main__':
         response = await call_next(request)
         return response
 
+    class SessionApiKeyRequest(BaseModel):
+        session_api_key: str
+
+    @app.post('/set_session_api_key')
+    async def set_session_api_key(request_body: SessionApiKeyRequest):
+        """Rotate the session API key (warm pool adoption).
+
+        Warm containers boot with a random bootstrap secret baked into their
+        environment, so they are never unauthenticated; the adopting session
+        authenticates with that secret (enforced by the middleware like any
+        other request) and rotates to its own per-session key. Servers booted
+        without any key refuse rotation - on those, the endpoint would let an
+        arbitrary peer lock out the legitimate user.
+        """
+        global SESSION_API_KEY, mcp_proxy_manager
+        if not SESSION_API_KEY:
+            raise HTTPException(
+                status_code=403, detail='No session API key configured'
+            )
+        SESSION_API_KEY = request_body.session_api_key
+        # Re-derive MCP auth so the proxy trusts the new key - not the
+        # bootstrap secret - for the rest of the container's life
+        if mcp_proxy_manager is not None:
+            try:
+                await mcp_proxy_manager.update_api_key(app, SESSION_API_KEY, ['*'])
+            except Exception as e:
+                logger.error(f'Error rotating MCP proxy auth: {e}', exc_info=True)
+                raise HTTPException(
+                    status_code=500, detail='Failed to rotate MCP proxy auth'
+                )
+        return JSONResponse(
+            content={'detail': 'Session API key rotated'}, status_code=200
+        )
+
     @app.get('/server_info')
     async def get_server_info():
         assert client is not None
@@ -969,6 +1010,55 @@ if __name__ == '__main__':
         except Exception as e:
             raise HTTPException(status_code=500, detail=str(e))
 
+    # Chunked, resumable downloads: the archive is built once, then served by
+    # byte range so clients can fetch chunks in parallel and retry individual
+    # ranges (see openhands/runtime/utils/download_transfers.py)
+    download_transfers = DownloadTransfers()
+
+    @app.post('/download_prepare')
+    def download_prepare(path: str):
+        """Build the archive for a chunked download and return its transfer id and size."""
+        try:
+            if not os.path.isabs(path):
+                raise HTTPException(
+                    status_code=400, detail='Path must be an absolute path'
+                )
+            if not os.path.exists(path):
+                raise HTTPException(status_code=404, detail='File not found')
+            return JSONResponse(
+                content=download_transfers.prepare(path), status_code=200
+            )
+        except HTTPException:
+            raise
+        except Exception as e:
+            raise HTTPException(status_code=500, detail=str(e))
+
+    @app.get('/download_chunk')
+    def download_chunk(transfer_id: str, request: Request):
+        """Serve one byte range of a prepared download with a single seek and bounded memory."""
+        try:
+            data, start, end, size = download_transfers.read_chunk(
+                transfer_id, request.headers.get('range')
+            )
+        except KeyError:
+            raise HTTPException(status_code=404, detail='Unknown transfer id')
+        except RangeError as e:
+            raise HTTPException(status_code=e.status_code, detail=e.detail)
+        return Response(
+            content=data,
+            status_code=206,
+            media_type='application/octet-stream',
+            headers={'Content-Range': f'bytes {start}-{end}/{size}'},
+        )
+
+    @app.post('/download_complete')
+    def download_complete(transfer_id: str):
+        """Release a prepared download and delete its archive."""
+        return JSONResponse(
+            content={'removed': download_transfers.complete(transfer_id)},
+            status_code=200,
+        )
+
     @app.get('/alive')
     async def alive():
         if client is None or not client.initialized:
@@ -68,6 +68,7 @@ from openhands.runtime.plugins import (
 from openhands.runtime.runtime_status import RuntimeStatus
 from openhands.runtime.utils.edit import FileEditRuntimeMixin
 from openhands.runtime.utils.git_handler import CommandResult, GitHandler
+from openhands.runtime.utils.read_prefetch import ReadPrefetcher
 from openhands.security import SecurityAnalyzer, options
 from openhands.storage.locations import get_conversation_dir
 from openhands.utils.async_utils import (
@@ -75,6 +76,7 @@ from openhands.utils.async_utils import (
     call_async_from_sync,
     call_sync_from_async,
 )
+from openhands.utils.tracing import trace_span
 
 
 def _default_env_vars(sandbox_config: SandboxConfig) -> dict[str, str]:
@@ -159,6 +161,11 @@ class Runtime(FileEditRuntimeMixin):
 
         self.status_callback = status_callback
         self.attach_to_existing = attach_to_existing
+        # Optional speculative prefetch of recently-read files while the LLM
+        # is thinking (see openhands/runtime/utils/read_prefetch.py)
+        self._read_prefetcher: ReadPrefetcher | None = None
+        if os.environ.get('RUNTIME_READ_PREFETCH', 'false').lower() == 'true':
+            self._read_prefetcher = ReadPrefetcher(self.run_action)
 
         self.config = copy.deepcopy(config)
         atexit.register(self.close)
@@ -372,12 +379,22 @@ class Runtime(FileEditRuntimeMixin):
             # We don't block the command if this is a default timeout action
             event.set_hard_timeout(self.config.sandbox.timeout, blocking=False)
         assert event.timeout is not None
+        prefetched: Observation | None = None
+        if self._read_prefetcher is not None:
+            prefetched = self._read_prefetcher.on_action(event)
         try:
             await self._export_latest_git_provider_tokens(event)
-            if isinstance(event, MCPAction):
-                observation: Observation = await self.call_tool_mcp(event)
-            else:
-                observation = await call_sync_from_async(self.run_action, event)
+            with trace_span(
+                'runtime.run_action',
+                conversation_id=self.sid,
+                action_type=type(event).__name__,
+            ):
+                if prefetched is not None:
+                    observation: Observation = prefetched
+                elif isinstance(event, MCPAction):
+                    observation = await self.call_tool_mcp(event)
+                else:
+                    observation = await call_sync_from_async(self.run_action, event)
         except PermissionError as e:
             # Handle PermissionError specially - convert to ErrorObservation
             # so the agent can receive feedback and continue execution
@@ -407,6 +424,11 @@ class Runtime(FileEditRuntimeMixin):
             return
         self.event_stream.add_event(observation, source)  # type: ignore[arg-type]
 
+        if self._read_prefetcher is not None:
+            # The agent is about to think - refresh its recent reads while
+            # the runtime is idle
+            self._read_prefetcher.after_action()
+
     async def clone_or_init_repo(
         self,
         git_provider_tokens: PROVIDER_TOKEN_TYPE | None,
@@ -5,25 +5,44 @@ import numpy as np
 from PIL import Image
 
 
-def image_to_png_base64_url(
-    image: np.ndarray | Image.Image, add_data_prefix: bool = False
+def image_to_base64_url(
+    image: np.ndarray | Image.Image,
+    add_data_prefix: bool = False,
+    image_format: str = 'png',
+    quality: int = 85,
 ) -> str:
-    """Convert a numpy array to a base64 encoded png image url."""
+    """Convert an image to a base64 encoded data url.
+
+    Supports 'png' (lossless) plus the much smaller lossy codecs 'webp' and
+    'jpeg'; quality only applies to the lossy codecs.
+    """
     if isinstance(image, np.ndarray):
         image = Image.fromarray(image)
     if image.mode in ('RGBA', 'LA'):
         image = image.convert('RGB')
     buffered = io.BytesIO()
-    image.save(buffered, format='PNG')
+    image_format = image_format.lower()
+    if image_format in ('webp', 'jpeg'):
+        image.save(buffered, format=image_format.upper(), quality=quality)
+    else:
+        image_format = 'png'
+        image.save(buffered, format='PNG')
 
     image_base64 = base64.b64encode(buffered.getvalue()).decode()
     return (
-        f'data:image/png;base64,{image_base64}'
+        f'data:image/{image_format};base64,{image_base64}'
         if add_data_prefix
         else f'{image_base64}'
     )
 
 
+def image_to_png_base64_url(
+    image: np.ndarray | Image.Image, add_data_prefix: bool = False
+) -> str:
+    """Convert a numpy array to a base64 encoded png image url."""
+    return image_to_base64_url(image, add_data_prefix=add_data_prefix)
+
+
 def png_base64_url_to_image(png_base64_url: str) -> Image.Image:
     """Convert a base64 encoded png image url to a PIL Image."""
     splited = png_base64_url.split(',')
@@ -1,6 +1,8 @@
 import atexit
+import hashlib
 import json
 import multiprocessing
+import os
 import time
 import uuid
 
@@ -12,7 +14,7 @@ from browsergym.utils.obs import flatten_dom_to_str, overlay_som
 
 from openhands.core.exceptions import BrowserInitException
 from openhands.core.logger import openhands_logger as logger
-from openhands.runtime.browser.base64 import image_to_png_base64_url
+from openhands.runtime.browser.base64 import image_to_base64_url
 from openhands.utils.shutdown_listener import should_continue, should_exit
 from openhands.utils.tenacity_stop import stop_if_should_exit
 
@@ -26,6 +28,15 @@ class BrowserEnv:
         self.eval_mode = False
         self.eval_dir = ''
 
+        # Screenshot encoding configuration, plus the last-frame cache used by
+        # the browser process to skip re-encoding visually unchanged frames
+        self.screenshot_format = os.getenv('BROWSER_SCREENSHOT_FORMAT', 'webp').lower()
+        self.screenshot_quality = int(os.getenv('BROWSER_SCREENSHOT_QUALITY', '80'))
+        self._last_screenshot_hash: str | None = None
+        self._last_screenshot_url: str | None = None
+        self._last_som_hash: str | None = None
+        self._last_som_url: str | None = None
+
         # EVAL only: browsergym_eval_env must be provided for evaluation
         self.browsergym_eval_env = browsergym_eval_env
         self.eval_mode = bool(browsergym_eval_env)
@@ -165,16 +176,42 @@ class BrowserEnv:
                     # add text content of the page
                     html_str = flatten_dom_to_str(obs['dom_object'])
                     obs['text_content'] = self.html_text_converter.handle(html_str)
-                    # make observation serializable
-                    obs['set_of_marks'] = image_to_png_base64_url(
-                        overlay_som(
-                            obs['screenshot'], obs.get('extra_element_properties', {})
-                        ),
-                        add_data_prefix=True,
-                    )
-                    obs['screenshot'] = image_to_png_base64_url(
-                        obs['screenshot'], add_data_prefix=True
+                    # make observation serializable. Encoding is skipped for
+                    # visually unchanged frames by reusing the previous url.
+                    screenshot_hash = hashlib.sha1(
+                        obs['screenshot'].tobytes()
+                    ).hexdigest()
+                    som_hash = (
+                        screenshot_hash
+                        + hashlib.sha1(
+                            repr(obs.get('extra_element_properties', {})).encode()
+                        ).hexdigest()
                     )
+                    if som_hash == self._last_som_hash:
+                        obs['set_of_marks'] = self._last_som_url
+                    else:
+                        obs['set_of_marks'] = image_to_base64_url(
+                            overlay_som(
+                                obs['screenshot'],
+                                obs.get('extra_element_properties', {}),
+                            ),
+                            add_data_prefix=True,
+                            image_format=self.screenshot_format,
+                            quality=self.screenshot_quality,
+                        )
+                        self._last_som_hash = som_hash
+                        self._last_som_url = obs['set_of_marks']
+                    if screenshot_hash == self._last_screenshot_hash:
+                        obs['screenshot'] = self._last_screenshot_url
+                    else:
+                        obs['screenshot'] = image_to_base64_url(
+                            obs['screenshot'],
+                            add_data_prefix=True,
+                            image_format=self.screenshot_format,
+                            quality=self.screenshot_quality,
+                        )
+                        self._last_screenshot_hash = screenshot_hash
+                        self._last_screenshot_url = obs['screenshot']
                     obs['active_page_index'] = obs['active_page_index'].item()
                     obs['elapsed_time'] = obs['elapsed_time'].item()
                     self.browser_side.send((unique_request_id, obs))
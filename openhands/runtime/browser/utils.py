@@ -130,9 +130,17 @@ async def browse(
             screenshots_dir = Path(workspace_dir) / '.browser_screenshots'
             screenshots_dir.mkdir(exist_ok=True)
 
-            # Generate a filename based on timestamp
+            # Generate a filename based on timestamp, with the extension
+            # matching the codec the browser encoded with
+            data_url = obs.get('screenshot', '')
+            if data_url.startswith('data:image/webp'):
+                extension = 'webp'
+            elif data_url.startswith('data:image/jpeg'):
+                extension = 'jpg'
+            else:
+                extension = 'png'
             timestamp = datetime.datetime.now().strftime('%Y%m%d_%H%M%S_%f')
-            screenshot_filename = f'screenshot_{timestamp}.png'
+            screenshot_filename = f'screenshot_{timestamp}.{extension}'
             screenshot_path = str(screenshots_dir / screenshot_filename)
 
             # Direct image saving from base64 data without using PIL's Image.open
@@ -197,6 +205,15 @@ async def browse(
             observation.axtree_object = {}
             observation.extra_element_properties = {}
 
+        # Out-of-band mode: the stored event carries only the file reference,
+        # keeping screenshots out of the event store entirely
+        if (
+            screenshot_path is not None
+            and os.environ.get('BROWSER_SCREENSHOT_INLINE', 'true').lower() == 'false'
+        ):
+            observation.screenshot = ''
+            observation.set_of_marks = ''
+
         return observation
     except Exception as e:
         error_message = str(e)
@@ -1,6 +1,7 @@
 import os
 import tempfile
 import threading
+from concurrent.futures import ThreadPoolExecutor
 from pathlib import Path
 from typing import Any
 from zipfile import ZipFile
@@ -16,6 +17,7 @@ from openhands.core.config.mcp_config import (
     MCPStdioServerConfig,
 )
 from openhands.core.exceptions import (
+    AgentRuntimeError,
     AgentRuntimeTimeoutError,
 )
 from openhands.events import EventStream
@@ -163,8 +165,23 @@ class ActionExecutionClient(Runtime):
         except httpx.TimeoutException:
             raise TimeoutError('List files operation timed out')
 
+    # Chunk size and parallelism for ranged downloads in copy_from
+    DOWNLOAD_CHUNK_SIZE = 8 * 1024 * 1024
+    DOWNLOAD_MAX_WORKERS = 4
+
     def copy_from(self, path: str) -> Path:
         """Zip all files in the sandbox and return as a stream of bytes."""
+        try:
+            return self._copy_from_chunked(path)
+        except httpx.HTTPStatusError as e:
+            if e.response.status_code not in (404, 405):
+                raise
+            # Older action execution server without the chunked download API
+            self.log(
+                'debug', 'Chunked download API unavailable, using single stream'
+            )
+        except httpx.TimeoutException:
+            raise TimeoutError('Copy operation timed out')
         try:
             params = {'path': path}
             with self.session.stream(
@@ -183,6 +200,75 @@ class ActionExecutionClient(Runtime):
         except httpx.TimeoutException:
             raise TimeoutError('Copy operation timed out')
 
+    def _copy_from_chunked(self, path: str) -> Path:
+        """Download the sandbox archive by byte range, several chunks in parallel.
+
+        Each chunk is fetched (and retried) independently, so a transient
+        failure only re-transfers that range instead of the whole archive.
+        """
+        response = self._send_action_server_request(
+            'POST',
+            f'{self.action_execution_server_url}/download_prepare',
+            params={'path': path},
+            timeout=300,
+        )
+        transfer = response.json()
+        transfer_id: str = transfer['transfer_id']
+        size: int = transfer['size']
+
+        temp_file = tempfile.NamedTemporaryFile(suffix='.zip', delete=False)
+        temp_file.truncate(size)
+        temp_file.close()
+
+        def fetch_chunk(start: int) -> None:
+            end = min(start + self.DOWNLOAD_CHUNK_SIZE, size) - 1
+            last_error: Exception | None = None
+            for _ in range(3):
+                try:
+                    chunk_response = self.session.request(
+                        'GET',
+                        f'{self.action_execution_server_url}/download_chunk',
+                        params={'transfer_id': transfer_id},
+                        headers={'Range': f'bytes={start}-{end}'},
+                        timeout=300,
+                    )
+                    chunk_response.raise_for_status()
+                    # Each worker opens its own handle so positional writes
+                    # stay independent (os.pwrite is not portable to Windows)
+                    with open(temp_file.name, 'r+b') as output:
+                        output.seek(start)
+                        output.write(chunk_response.content)
+                    return
+                except (httpx.HTTPError, OSError) as e:
+                    last_error = e
+            raise AgentRuntimeError(
+                f'Failed to download chunk {start}-{end} of {path}: {last_error}'
+            )
+
+        try:
+            starts = range(0, size, self.DOWNLOAD_CHUNK_SIZE)
+            if starts:
+                with ThreadPoolExecutor(
+                    max_workers=min(self.DOWNLOAD_MAX_WORKERS, len(starts))
+                ) as executor:
+                    for result in executor.map(fetch_chunk, starts):
+                        pass  # surface the first chunk failure, if any
+            return Path(temp_file.name)
+        except Exception:
+            os.unlink(temp_file.name)
+            raise
+        finally:
+            try:
+                self._send_action_server_request(
+                    'POST',
+                    f'{self.action_execution_server_url}/download_complete',
+                    params={'transfer_id': transfer_id},
+                    timeout=30,
+                )
+            except httpx.HTTPError:
+                # The server purges stale transfers on its own
+                self.log('debug', f'Failed to release download transfer {transfer_id}')
+
     def copy_to(
         self, host_src: str, sandbox_dest: str, recursive: bool = False
     ) -> None:
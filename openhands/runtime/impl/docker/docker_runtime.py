@@ -1,9 +1,12 @@
+import hashlib
+import json
 import os
 import platform
+import time
 import typing
 from functools import lru_cache
 from typing import Callable
-from uuid import UUID
+from uuid import UUID, uuid4
 
 import docker
 import httpx
@@ -26,6 +29,7 @@ from openhands.runtime.impl.action_execution.action_execution_client import (
     ActionExecutionClient,
 )
 from openhands.runtime.impl.docker.containers import stop_all_containers
+from openhands.runtime.impl.docker.warm_pool import DockerWarmPool, WarmContainer
 from openhands.runtime.plugins import PluginRequirement
 from openhands.runtime.runtime_status import RuntimeStatus
 from openhands.runtime.utils import find_available_tcp_port
@@ -178,15 +182,23 @@ class DockerRuntime(ActionExecutionClient):
                     f'Container {self.container_name} not found.',
                 )
                 raise AgentRuntimeDisconnectedError from e
-            self.maybe_build_runtime_container_image()
-            self.log(
-                'info', f'Starting runtime with image: {self.runtime_container_image}'
-            )
-            await call_sync_from_async(self.init_container)
-            self.log(
-                'info',
-                f'Container started: {self.container_name}. VSCode URL: {self.vscode_url}',
-            )
+            adopted = await call_sync_from_async(self.try_adopt_warm_container)
+            if adopted:
+                self.log(
+                    'info',
+                    f'Adopted warm container as {self.container_name}. VSCode URL: {self.vscode_url}',
+                )
+            else:
+                self.maybe_build_runtime_container_image()
+                self.log(
+                    'info',
+                    f'Starting runtime with image: {self.runtime_container_image}',
+                )
+                await call_sync_from_async(self.init_container)
+                self.log(
+                    'info',
+                    f'Container started: {self.container_name}. VSCode URL: {self.vscode_url}',
+                )
 
         if DEBUG_RUNTIME and self.container:
             self.log_streamer = LogStreamer(self.container, self.log)
@@ -541,6 +553,293 @@ class DockerRuntime(ActionExecutionClient):
             self.close()
             raise e
 
+    def _warm_pool_enabled(self) -> bool:
+        """Whether this runtime can draw from / feed the warm container pool."""
+        sandbox = self.config.sandbox
+        if sandbox.warm_pool_size <= 0:
+            return False
+        if self.runtime_container_image is None:
+            # Pooling only makes sense for a prebuilt image
+            return False
+        if sandbox.vscode_port:
+            # A fixed VSCode port cannot be shared between warm containers
+            return False
+        volumes = self._process_volumes()
+        if any(
+            self.sid in str(host_path) or self.sid in str(mount_spec)
+            for host_path, mount_spec in volumes.items()
+        ):
+            # Bind mounts are fixed at container creation, so per-session
+            # mounts cannot be served by a pre-booted container. Static
+            # volumes (e.g. a shared workspace mount) are fine - warm
+            # containers are created with the same mounts.
+            return False
+        if self._process_overlay_mounts():
+            # Overlay upper dirs are per-container copy-on-write state
+            return False
+        return True
+
+    def _warm_pool_key(self) -> str:
+        """Fingerprint of everything baked into a container at creation."""
+        fingerprint = json.dumps(
+            {
+                'image': self.runtime_container_image,
+                'plugins': sorted(plugin.name for plugin in self.plugins),
+                'main_module': self.main_module,
+                'env': self.initial_env_vars,
+                # SESSION_API_KEY is delivered after adoption, never baked in
+                'startup_env': {
+                    key: value
+                    for key, value in self.config.sandbox.runtime_startup_env_vars.items()
+                    if key != 'SESSION_API_KEY'
+                },
+                'volumes': self._process_volumes(),
+                'gpu': self.config.sandbox.enable_gpu,
+                'host_network': self.config.sandbox.use_host_network,
+            },
+            sort_keys=True,
+            default=str,
+        )
+        return hashlib.md5(fingerprint.encode()).hexdigest()
+
+    def _get_warm_pool(self) -> DockerWarmPool:
+        return DockerWarmPool.get_pool(
+            self._warm_pool_key(),
+            self.config.sandbox.warm_pool_size,
+            self.config.sandbox.warm_pool_idle_timeout,
+        )
+
+    def try_adopt_warm_container(self) -> bool:
+        """Claim a warm container when pooling is enabled and applicable.
+
+        Returns True if a pre-booted container was adopted for this session,
+        in which case init_container must be skipped.
+        """
+        if not self._warm_pool_enabled():
+            return False
+        return self._try_adopt_warm_container()
+
+    def _try_adopt_warm_container(self) -> bool:
+        """Claim a pre-booted container from the pool, if one is available.
+
+        A miss still registers this runtime's spawner with the pool so it gets
+        replenished in the background for the next conversation.
+        """
+        pool = self._get_warm_pool()
+        pool.set_spawner(self._build_warm_container)
+        entry = pool.claim()
+        if entry is None:
+            return False
+        try:
+            entry.container.rename(self.container_name)
+            entry.container.reload()
+            if entry.container.status != 'running':
+                raise AgentRuntimeNotFoundError(
+                    f'Warm container is {entry.container.status}, not running'
+                )
+        except Exception as e:
+            self.log('warning', f'Discarding unusable warm container: {e}')
+            entry.discard()
+            return False
+        if not self._deliver_session_api_key(entry):
+            entry.discard()
+            return False
+        self.container = entry.container
+        self._host_port = entry.host_port
+        self._container_port = entry.host_port
+        self._vscode_port = entry.vscode_port
+        self._app_ports = entry.app_ports
+        self._host_port_lock = entry.host_port_lock
+        self._vscode_port_lock = entry.vscode_port_lock
+        self._app_port_locks = entry.app_port_locks
+        self.api_url = f'{self.config.sandbox.local_runtime_url}:{self._container_port}'
+        self.set_runtime_status(RuntimeStatus.RUNTIME_STARTED)
+        return True
+
+    def _deliver_session_api_key(self, entry: WarmContainer) -> bool:
+        """Rotate a freshly adopted container onto this session's API key.
+
+        Warm containers boot with a random bootstrap secret, so the rotation
+        request authenticates with it; keyless deployments keep using the
+        bootstrap secret instead, which still leaves the container
+        authenticated for its whole life.
+        """
+        session_api_key = self.config.sandbox.runtime_startup_env_vars.get(
+            'SESSION_API_KEY'
+        )
+        if not session_api_key:
+            self.session.headers['X-Session-API-Key'] = entry.bootstrap_secret
+            return True
+        api_url = f'{self.config.sandbox.local_runtime_url}:{entry.host_port}'
+        try:
+            response = self.session.request(
+                'POST',
+                f'{api_url}/set_session_api_key',
+                json={'session_api_key': session_api_key},
+                headers={'X-Session-API-Key': entry.bootstrap_secret},
+                timeout=10,
+            )
+            response.raise_for_status()
+            return True
+        except httpx.HTTPError as e:
+            self.log(
+                'warning', f'Failed to deliver session API key to warm container: {e}'
+            )
+            return False
+
+    def _build_warm_container(self) -> WarmContainer:
+        """Boot one warm sandbox container and wait until its server is alive.
+
+        Runs on the pool's replenisher thread, so it must only use local
+        state - never the port/container attributes of this runtime instance.
+        """
+        host_port, host_lock = self._find_available_port_with_lock(
+            EXECUTION_SERVER_PORT_RANGE
+        )
+        vscode_port, vscode_lock = self._find_available_port_with_lock(
+            VSCODE_PORT_RANGE
+        )
+        app_port_1, app_lock_1 = self._find_available_port_with_lock(APP_PORT_RANGE_1)
+        app_port_2, app_lock_2 = self._find_available_port_with_lock(APP_PORT_RANGE_2)
+        app_ports = [app_port_1, app_port_2]
+        app_port_locks = [lock for lock in [app_lock_1, app_lock_2] if lock is not None]
+        container_name = f'{CONTAINER_NAME_PREFIX}warm-{uuid4().hex[:12]}'
+
+        use_host_network = self.config.sandbox.use_host_network
+        network_mode: typing.Literal['host'] | None = (
+            'host' if use_host_network else None
+        )
+        port_mapping: dict[str, list[dict[str, str]]] | None = None
+        if not use_host_network:
+            port_mapping = {
+                f'{host_port}/tcp': [
+                    {
+                        'HostPort': str(host_port),
+                        'HostIp': self.config.sandbox.runtime_binding_address,
+                    }
+                ],
+            }
+            if self.vscode_enabled:
+                port_mapping[f'{vscode_port}/tcp'] = [
+                    {
+                        'HostPort': str(vscode_port),
+                        'HostIp': self.config.sandbox.runtime_binding_address,
+                    }
+                ]
+            for port in app_ports:
+                port_mapping[f'{port}/tcp'] = [
+                    {
+                        'HostPort': str(port),
+                        'HostIp': self.config.sandbox.runtime_binding_address,
+                    }
+                ]
+
+        environment = dict(**self.initial_env_vars)
+        environment.update(
+            {
+                'port': str(host_port),
+                'PYTHONUNBUFFERED': '1',
+                'VSCODE_PORT': str(vscode_port),
+                'APP_PORT_1': str(app_ports[0]),
+                'APP_PORT_2': str(app_ports[1]),
+                'OPENHANDS_SESSION_ID': container_name,
+                'PIP_BREAK_SYSTEM_PACKAGES': '1',
+            }
+        )
+        if self.config.debug or DEBUG:
+            environment['DEBUG'] = 'true'
+        startup_env = dict(self.config.sandbox.runtime_startup_env_vars)
+        # The container boots with a random bootstrap secret so its API (and
+        # MCP surface) is never unauthenticated while waiting in the pool;
+        # adoption rotates it to the session's own key
+        bootstrap_secret = uuid4().hex
+        startup_env['SESSION_API_KEY'] = bootstrap_secret
+        environment.update(startup_env)
+
+        command = get_action_execution_server_startup_command(
+            server_port=host_port,
+            plugins=self.plugins,
+            app_config=self.config,
+            main_module=self.main_module,
+        )
+
+        if self.config.sandbox.enable_gpu:
+            gpu_ids = self.config.sandbox.cuda_visible_devices
+            if gpu_ids is None:
+                device_requests = [
+                    docker.types.DeviceRequest(capabilities=[['gpu']], count=-1)
+                ]
+            else:
+                device_requests = [
+                    docker.types.DeviceRequest(
+                        capabilities=[['gpu']],
+                        device_ids=[str(i) for i in gpu_ids.split(',')],
+                    )
+                ]
+        else:
+            device_requests = None
+
+        entry: WarmContainer | None = None
+        try:
+            container = self.docker_client.containers.run(
+                self.runtime_container_image,
+                command=command,
+                entrypoint=[],
+                network_mode=network_mode,
+                ports=port_mapping,
+                working_dir='/openhands/code/',  # do not change this!
+                name=container_name,
+                detach=True,
+                environment=environment,
+                volumes=self._process_volumes() or None,  # type: ignore
+                device_requests=device_requests,
+                **(self.config.sandbox.docker_runtime_kwargs or {}),
+            )
+            entry = WarmContainer(
+                container=container,
+                host_port=host_port,
+                vscode_port=vscode_port,
+                app_ports=app_ports,
+                host_port_lock=host_lock,
+                vscode_port_lock=vscode_lock,
+                app_port_locks=app_port_locks,
+                bootstrap_secret=bootstrap_secret,
+            )
+            self._wait_warm_container_alive(entry)
+            self.log('debug', f'Warm container ready: {container_name}')
+            return entry
+        except Exception:
+            if entry is not None:
+                entry.discard()
+            else:
+                for lock in [host_lock, vscode_lock, *app_port_locks]:
+                    if lock is not None:
+                        lock.release()
+            raise
+
+    def _wait_warm_container_alive(self, entry: WarmContainer) -> None:
+        """Poll the warm container's /alive endpoint until it responds."""
+        api_url = f'{self.config.sandbox.local_runtime_url}:{entry.host_port}'
+        deadline = time.time() + self.config.sandbox.timeout
+        while time.time() < deadline:
+            try:
+                response = self.session.request(
+                    'GET', f'{api_url}/alive', timeout=5
+                )
+                if response.status_code == 200:
+                    return
+            except httpx.HTTPError:
+                pass
+            entry.container.reload()
+            if entry.container.status in ('exited', 'dead'):
+                raise AgentRuntimeNotFoundError(
+                    f'Warm container {entry.container.name} exited during boot'
+                )
+            time.sleep(1)
+        raise AgentRuntimeNotFoundError(
+            f'Warm container {entry.container.name} did not become ready in time'
+        )
+
     def _attach_to_container(self) -> None:
         self.container = self.docker_client.containers.get(self.container_name)
         if self.container.status == 'exited':
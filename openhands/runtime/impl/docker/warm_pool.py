@@ -0,0 +1,166 @@
+"""Warm pool of pre-booted sandbox containers for DockerRuntime.
+
+Booting a sandbox container and waiting for its action execution server takes
+10-30s and dominates short conversations. The pool keeps a few containers
+booted ahead of time, keyed by a fingerprint of everything baked into the
+container at creation (image, plugins, environment), hands one out on
+`claim()` and replenishes in the background.
+
+Warm containers are named with the regular container prefix, so the existing
+shutdown listener cleans them up with everything else.
+"""
+
+import threading
+import time
+from dataclasses import dataclass, field
+from typing import Callable
+
+from docker.models.containers import Container
+
+from openhands.core.logger import openhands_logger as logger
+from openhands.runtime.utils.port_lock import PortLock
+
+
+@dataclass
+class WarmContainer:
+    """A booted sandbox container waiting to be claimed by a conversation."""
+
+    container: Container
+    host_port: int
+    vscode_port: int
+    app_ports: list[int]
+    host_port_lock: PortLock | None
+    vscode_port_lock: PortLock | None
+    app_port_locks: list[PortLock]
+    # Random per-container secret baked into SESSION_API_KEY at boot, so the
+    # server is authenticated before adoption; rotated to the session's own
+    # key when claimed
+    bootstrap_secret: str = ''
+    created_at: float = field(default_factory=time.time)
+
+    def discard(self) -> None:
+        """Release the container and its port locks."""
+        locks = [self.host_port_lock, self.vscode_port_lock, *self.app_port_locks]
+        for lock in locks:
+            if lock is None:
+                continue
+            try:
+                lock.release()
+            except Exception:
+                pass
+        try:
+            self.container.remove(force=True)
+        except Exception:
+            logger.debug(f'Failed to remove warm container {self.container.name}')
+
+
+class DockerWarmPool:
+    """A pool of warm containers for one container spec fingerprint."""
+
+    _pools: dict[str, 'DockerWarmPool'] = {}
+    _pools_lock = threading.Lock()
+
+    @classmethod
+    def get_pool(cls, key: str, size: int, idle_timeout: float) -> 'DockerWarmPool':
+        with cls._pools_lock:
+            pool = cls._pools.get(key)
+            if pool is None:
+                pool = cls(key, size, idle_timeout)
+                cls._pools[key] = pool
+            else:
+                # The most recent configuration wins
+                pool.size = size
+                pool.idle_timeout = idle_timeout
+            return pool
+
+    @classmethod
+    def all_metrics(cls) -> dict[str, dict[str, int]]:
+        """Per-pool counters, for logging / monitoring."""
+        with cls._pools_lock:
+            pools = list(cls._pools.values())
+        return {pool.key: pool.get_metrics() for pool in pools}
+
+    def __init__(self, key: str, size: int, idle_timeout: float):
+        self.key = key
+        self.size = size
+        self.idle_timeout = idle_timeout
+        self._entries: list[WarmContainer] = []
+        self._lock = threading.Lock()
+        self._spawn: Callable[[], WarmContainer] | None = None
+        self._replenishing = False
+        self._metrics = {
+            'hits': 0,
+            'misses': 0,
+            'spawned': 0,
+            'reaped': 0,
+            'spawn_failures': 0,
+        }
+
+    def set_spawner(self, spawn: Callable[[], WarmContainer]) -> None:
+        """Set the callable used to boot replacement warm containers."""
+        with self._lock:
+            self._spawn = spawn
+
+    def claim(self) -> WarmContainer | None:
+        """Pop a warm container if one is available, then replenish async.
+
+        A miss still triggers replenishment, so the first conversation pays
+        the cold start and later ones do not.
+        """
+        self.reap_idle()
+        with self._lock:
+            entry = self._entries.pop(0) if self._entries else None
+            self._metrics['hits' if entry else 'misses'] += 1
+        self._replenish_async()
+        return entry
+
+    def reap_idle(self) -> None:
+        """Discard warm containers that have been waiting too long."""
+        cutoff = time.time() - self.idle_timeout
+        with self._lock:
+            stale = [entry for entry in self._entries if entry.created_at < cutoff]
+            self._entries = [
+                entry for entry in self._entries if entry.created_at >= cutoff
+            ]
+            self._metrics['reaped'] += len(stale)
+        for entry in stale:
+            logger.debug(f'Reaping idle warm container {entry.container.name}')
+            entry.discard()
+
+    def get_metrics(self) -> dict[str, int]:
+        with self._lock:
+            return {**self._metrics, 'available': len(self._entries)}
+
+    def _replenish_async(self) -> None:
+        with self._lock:
+            if self._replenishing or self._spawn is None:
+                return
+            if len(self._entries) >= self.size:
+                return
+            self._replenishing = True
+        thread = threading.Thread(target=self._replenish, daemon=True)
+        thread.start()
+
+    def _replenish(self) -> None:
+        try:
+            while True:
+                with self._lock:
+                    spawn = self._spawn
+                    if spawn is None or len(self._entries) >= self.size:
+                        return
+                try:
+                    entry = spawn()
+                except Exception:
+                    logger.warning(
+                        f'Failed to spawn warm container for pool {self.key}',
+                        exc_info=True,
+                    )
+                    with self._lock:
+                        self._metrics['spawn_failures'] += 1
+                    return
+                with self._lock:
+                    self._entries.append(entry)
+                    self._metrics['spawned'] += 1
+        finally:
+            with self._lock:
+                self._replenishing = False
@@ -127,6 +127,23 @@ class MCPProxyManager:
         app.mount('/', mcp_app)
         logger.info('Mounted FastMCP Proxy app at /mcp')
 
+    async def update_api_key(
+        self,
+        app: FastAPI,
+        api_key: Optional[str],
+        allow_origins: Optional[list[str]] = None,
+    ) -> None:
+        """Swap the authentication token and remount with the same tools.
+
+        Used when the session API key is rotated after a warm-pool adoption,
+        so the proxy stops trusting the bootstrap secret.
+        """
+        self.api_key = api_key
+        self.auth_enabled = bool(api_key)
+        self.proxy = None
+        self.initialize()
+        await self.mount_to_app(app, allow_origins)
+
     async def update_and_remount(
         self,
         app: FastAPI,
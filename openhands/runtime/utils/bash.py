@@ -1,5 +1,9 @@
+import logging
 import os
 import re
+import shutil
+import tempfile
+import threading
 import time
 import uuid
 from enum import Enum
@@ -183,6 +187,9 @@ def _remove_command_prefix(command_output: str, command: str) -> str:
 
 class BashSession:
     POLL_INTERVAL = 0.5
+    # Floor between pane captures on the event-driven path, so continuous
+    # output does not turn the execute loop into a capture-pane busy loop.
+    MIN_POLL_INTERVAL = 0.05
     HISTORY_LIMIT = 10_000
     PS1 = CmdOutputMetadata.to_ps1_prompt()
 
@@ -259,8 +266,54 @@ class BashSession:
 
         # Maintain the current working directory
         self._cwd = os.path.abspath(self.work_dir)
+
+        # Event-driven output notifications: tmux pipes pane output into a
+        # FIFO, and a reader thread flags new bytes so execute() can wake up
+        # with millisecond latency instead of sleeping a full poll interval.
+        self._output_event: threading.Event | None = None
+        self._pipe_dir: str | None = None
+        self._start_output_pipe()
         self._initialized = True
 
+    def _start_output_pipe(self) -> None:
+        """Pipe pane output into a FIFO and start the reader thread.
+
+        Failure is non-fatal: execute() falls back to sleep-based polling when
+        `_output_event` is None.
+        """
+        try:
+            self._pipe_dir = tempfile.mkdtemp(prefix='openhands-bash-pipe-')
+            pipe_path = os.path.join(self._pipe_dir, 'output')
+            os.mkfifo(pipe_path)
+            self.pane.cmd('pipe-pane', '-o', f'cat > {pipe_path}')
+            self._output_event = threading.Event()
+            reader = threading.Thread(
+                target=self._read_output_pipe, args=(pipe_path,), daemon=True
+            )
+            reader.start()
+        except Exception as e:
+            logger.warning(
+                f'Failed to set up event-driven pane output pipe, '
+                f'falling back to polling: {e}'
+            )
+            self._output_event = None
+
+    def _read_output_pipe(self, pipe_path: str) -> None:
+        """Drain the pane output FIFO, flagging every chunk of new bytes."""
+        output_event = self._output_event
+        assert output_event is not None
+        try:
+            with open(pipe_path, 'rb') as pipe:
+                while not self._closed:
+                    # Blocks until the pane produces output; EOF when the
+                    # pipe is closed on session shutdown.
+                    data = pipe.read1(65536)
+                    if not data:
+                        break
+                    output_event.set()
+        except Exception as e:
+            logger.warning(f'Pane output pipe reader stopped: {e}')
+
     def __del__(self) -> None:
         """Ensure the session is closed when the object is destroyed."""
         self.close()
@@ -280,8 +333,16 @@ class BashSession:
         """Clean up the session."""
         if self._closed:
             return
-        self.session.kill()
         self._closed = True
+        try:
+            # Toggle pipe-pane off so the writer side of the FIFO gets EOF
+            self.pane.cmd('pipe-pane')
+        except Exception:
+            pass
+        self.session.kill()
+        if self._pipe_dir is not None:
+            shutil.rmtree(self._pipe_dir, ignore_errors=True)
+            self._pipe_dir = None
 
     @property
     def cwd(self) -> str:
@@ -488,7 +549,7 @@ class BashSession:
             combined_output += output_segment + '\n'
         # Add the content after the last PS1 prompt
         combined_output += pane_content[ps1_matches[-1].end() + 1 :]
-        logger.debug(f'COMBINED OUTPUT: {combined_output}')
+        logger.debug('COMBINED OUTPUT: %s', combined_output)
         return combined_output
 
     def execute(self, action: CmdRunAction) -> CmdOutputObservation | ErrorObservation:
@@ -610,16 +671,23 @@ class BashSession:
         while should_continue():
             _start_time = time.time()
             logger.debug(f'GETTING PANE CONTENT at {_start_time}')
+            # Clear before capturing: bytes arriving after the capture will
+            # re-set the event and wake the next iteration immediately.
+            if self._output_event is not None:
+                self._output_event.clear()
             cur_pane_output = self._get_pane_content()
             logger.debug(
                 f'PANE CONTENT GOT after {time.time() - _start_time:.2f} seconds'
             )
-            cur_pane_lines = cur_pane_output.split('\n')
-            if len(cur_pane_lines) <= 20:
-                logger.debug('PANE_CONTENT: {cur_pane_output}')
-            else:
-                logger.debug(f'BEGIN OF PANE CONTENT: {cur_pane_lines[:10]}')
-                logger.debug(f'END OF PANE CONTENT: {cur_pane_lines[-10:]}')
+            # Lazy formatting: pane content is only split/serialized when
+            # debug logging is actually emitted
+            if logger.isEnabledFor(logging.DEBUG):
+                cur_pane_lines = cur_pane_output.split('\n')
+                if len(cur_pane_lines) <= 20:
+                    logger.debug('PANE_CONTENT: %s', cur_pane_output)
+                else:
+                    logger.debug('BEGIN OF PANE CONTENT: %s', cur_pane_lines[:10])
+                    logger.debug('END OF PANE CONTENT: %s', cur_pane_lines[-10:])
             ps1_matches = CmdOutputMetadata.matches_ps1_metadata(cur_pane_output)
             current_ps1_count = len(ps1_matches)
 
@@ -676,6 +744,15 @@ class BashSession:
                     timeout=action.timeout,
                 )
 
-            logger.debug(f'SLEEPING for {self.POLL_INTERVAL} seconds for next poll')
-            time.sleep(self.POLL_INTERVAL)
+            if self._output_event is not None:
+                # Event-driven: wake as soon as the pane produces output, with
+                # the poll interval only as a fallback for the timeout checks.
+                logger.debug(f'WAITING up to {self.POLL_INTERVAL} seconds for output')
+                if self._output_event.wait(timeout=self.POLL_INTERVAL):
+                    # Debounce so a chatty command coalesces its output into
+                    # one capture instead of one capture per chunk.
+                    time.sleep(self.MIN_POLL_INTERVAL)
+            else:
+                logger.debug(f'SLEEPING for {self.POLL_INTERVAL} seconds for next poll')
+                time.sleep(self.POLL_INTERVAL)
         raise RuntimeError('Bash session was likely interrupted...')
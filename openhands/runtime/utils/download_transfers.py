@@ -0,0 +1,126 @@
+"""Chunked, resumable download transfers for the action execution server.
+
+A transfer is prepared once (building the zip archive), then served by byte
+range so clients can fetch chunks in parallel and retry individual ranges;
+stale transfers are purged after a TTL. Kept HTTP-framework-free so the range
+handling is unit-testable - the server routes translate RangeError into
+HTTPException.
+"""
+
+import os
+import tempfile
+import threading
+import time
+import uuid
+from zipfile import ZipFile
+
+
+class RangeError(Exception):
+    """A Range header the transfer cannot serve."""
+
+    def __init__(self, status_code: int, detail: str):
+        super().__init__(detail)
+        self.status_code = status_code
+        self.detail = detail
+
+
+class DownloadTransfers:
+    """Registry of prepared archives served by byte range."""
+
+    DEFAULT_TTL_SECONDS = 3600.0
+    DEFAULT_MAX_CHUNK_SIZE = 64 * 1024 * 1024
+
+    def __init__(
+        self,
+        ttl_seconds: float = DEFAULT_TTL_SECONDS,
+        max_chunk_size: int = DEFAULT_MAX_CHUNK_SIZE,
+    ):
+        self.ttl_seconds = ttl_seconds
+        self.max_chunk_size = max_chunk_size
+        # transfer_id -> (zip path, size, created at)
+        self._transfers: dict[str, tuple[str, int, float]] = {}
+        self._lock = threading.Lock()
+
+    def prepare(self, path: str) -> dict:
+        """Build the archive for a path and register it as a transfer."""
+        self.purge_stale()
+        with tempfile.NamedTemporaryFile(suffix='.zip', delete=False) as temp_zip:
+            with ZipFile(temp_zip, 'w') as zipf:
+                for root, _, files in os.walk(path):
+                    for file in files:
+                        file_path = os.path.join(root, file)
+                        zipf.write(file_path, arcname=os.path.relpath(file_path, path))
+        size = os.path.getsize(temp_zip.name)
+        transfer_id = str(uuid.uuid4())
+        with self._lock:
+            self._transfers[transfer_id] = (temp_zip.name, size, time.time())
+        return {'transfer_id': transfer_id, 'size': size}
+
+    def parse_range(self, range_header: str | None, size: int) -> tuple[int, int]:
+        """Parse a 'bytes=start-end' header into an inclusive (start, end).
+
+        Raises RangeError with the appropriate HTTP status for a missing or
+        malformed header (400), out-of-bounds range (416), or a range larger
+        than the chunk size cap (416) - the cap keeps a single request from
+        buffering the whole archive in memory.
+        """
+        if not range_header or not range_header.startswith('bytes='):
+            raise RangeError(400, 'Range header required')
+        try:
+            range_value = range_header.removeprefix('bytes=')
+            start_str, end_str = range_value.split('-', 1)
+            start = int(start_str)
+            end = int(end_str) if end_str else size - 1
+        except ValueError:
+            raise RangeError(400, 'Malformed Range header')
+        if start < 0 or end >= size or start > end:
+            raise RangeError(416, f'Range out of bounds for size {size}')
+        if end - start + 1 > self.max_chunk_size:
+            raise RangeError(
+                416, f'Range exceeds max chunk size {self.max_chunk_size}'
+            )
+        return start, end
+
+    def read_chunk(
+        self, transfer_id: str, range_header: str | None
+    ) -> tuple[bytes, int, int, int]:
+        """Read one byte range of a prepared transfer.
+
+        Returns (data, start, end, size). Raises KeyError for an unknown
+        transfer and RangeError for an unservable range.
+        """
+        with self._lock:
+            zip_path, size, _ = self._transfers[transfer_id]
+        start, end = self.parse_range(range_header, size)
+        with open(zip_path, 'rb') as zip_file:
+            zip_file.seek(start)
+            data = zip_file.read(end - start + 1)
+        return data, start, end, size
+
+    def complete(self, transfer_id: str) -> bool:
+        """Release a transfer and delete its archive."""
+        with self._lock:
+            transfer = self._transfers.pop(transfer_id, None)
+        if transfer is None:
+            return False
+        try:
+            os.unlink(transfer[0])
+        except OSError:
+            pass
+        return True
+
+    def purge_stale(self) -> None:
+        """Drop transfers older than the TTL (e.g. a client that went away)."""
+        now = time.time()
+        with self._lock:
+            stale = [
+                transfer_id
+                for transfer_id, (_, _, created_at) in self._transfers.items()
+                if now - created_at > self.ttl_seconds
+            ]
+            stale_paths = [self._transfers.pop(tid)[0] for tid in stale]
+        for zip_path in stale_paths:
+            try:
+                os.unlink(zip_path)
+            except OSError:
+                pass
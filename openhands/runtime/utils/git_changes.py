@@ -62,9 +62,48 @@ def get_valid_ref(repo_dir: str) -> str | None:
     return None
 
 
+def git_supports_builtin_fsmonitor(repo_dir: str) -> bool:
+    """Whether this git has the builtin fsmonitor daemon (>= 2.37).
+
+    On older versions `core.fsmonitor` is interpreted as a *hook command* -
+    a value of `true` would run /bin/true, whose empty output means "nothing
+    changed", silently corrupting status/diff results.
+    """
+    try:
+        # 'git version 2.39.5' (possibly with a vendor suffix after it)
+        version_output = run('git --version', repo_dir)
+        parts = version_output.split()[2].split('.')
+        major, minor = int(parts[0]), int(parts[1])
+    except (RuntimeError, ValueError, IndexError):
+        return False
+    return (major, minor) >= (2, 37)
+
+
+def ensure_perf_config(repo_dir: str) -> None:
+    """Enable git's own caches so repeated polls stay cheap on huge repos.
+
+    core.untrackedCache keeps the untracked-file scan incremental and
+    core.fsmonitor starts git's filesystem watcher (builtin daemon only,
+    git >= 2.37), so an unchanged worktree answers from cached state instead
+    of a full rescan.
+    """
+    settings = [('core.untrackedCache', 'true')]
+    if git_supports_builtin_fsmonitor(repo_dir):
+        settings.append(('core.fsmonitor', 'true'))
+    for key, value in settings:
+        try:
+            current = run(f'git config --get {key} || true', repo_dir)
+            if current == value:
+                continue  # avoid rewriting .git/config (and its lock) per poll
+            run(f'git config {key} {value}', repo_dir)
+        except RuntimeError:
+            pass  # e.g. a read-only .git/config
+
+
 def get_changes_in_repo(repo_dir: str) -> list[dict[str, str]]:
     # Gets the status relative to the origin default branch - not the same as `git status`
 
+    ensure_perf_config(repo_dir)
     ref = get_valid_ref(repo_dir)
     if not ref:
         return []
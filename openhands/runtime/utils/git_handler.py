@@ -1,4 +1,5 @@
 import json
+import time
 from dataclasses import dataclass
 from pathlib import Path
 from typing import Callable
@@ -40,6 +41,8 @@ class GitHandler:
         self.git_changes_cmd = GIT_CHANGES_CMD
         self.git_diff_cmd = GIT_DIFF_CMD
         self.git_branch_cmd = GIT_BRANCH_CMD
+        # Last computed change set: ((cwd, repo state key), monotonic time, result)
+        self._changes_cache: tuple[tuple[str, str], float, list[dict[str, str]]] | None = None
 
     def set_cwd(self, cwd: str) -> None:
         """Sets the current working directory for Git operations.
@@ -79,12 +82,32 @@ class GitHandler:
         # If not a git repository or other error, return None
         return None
 
+    # How long a cached change set may be served while HEAD and the index are
+    # unchanged; bounds the staleness window for worktree-only edits, which
+    # do not show up in the state key
+    CHANGES_CACHE_TTL_SECONDS = 10.0
+
+    def _get_repo_state_key(self) -> str | None:
+        """A cheap fingerprint of the repository state: HEAD plus the mtime
+        and size of the index. Changes on every commit / stage / checkout."""
+        result = self.execute(
+            'git --no-pager rev-parse HEAD 2>/dev/null; '
+            'stat -c %Y-%s .git/index 2>/dev/null',
+            self.cwd,
+        )
+        if result.exit_code != 0 or not result.content.strip():
+            return None
+        return result.content.strip()
+
     def get_git_changes(self) -> list[dict[str, str]] | None:
         """Retrieves the list of changed files in Git repositories.
         Examines each direct subdirectory of the workspace directory looking for git repositories
         and returns the changes for each of these directories.
         Optimized to use a single git command per repository for maximum performance.
 
+        Repeated polls while HEAD and the index are unchanged are served from
+        a short-lived cache instead of rescanning the worktree.
+
         Returns:
             list[dict[str, str]] | None: A list of dictionaries containing file paths and statuses. None if no git repositories found.
         """
@@ -92,10 +115,22 @@ class GitHandler:
         if not self.cwd:
             return None
 
+        state_key = self._get_repo_state_key()
+        cached = self._changes_cache
+        if (
+            cached is not None
+            and state_key is not None
+            and cached[0] == (self.cwd, state_key)
+            and time.monotonic() - cached[1] < self.CHANGES_CACHE_TTL_SECONDS
+        ):
+            return cached[2]
+
         result = self.execute(self.git_changes_cmd, self.cwd)
         if result.exit_code == 0:
             try:
                 changes = json.loads(result.content)
+                if state_key is not None and isinstance(changes, list):
+                    self._changes_cache = ((self.cwd, state_key), time.monotonic(), changes)
                 return changes
             except Exception:
                 logger.exception(
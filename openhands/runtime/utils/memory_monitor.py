@@ -1,6 +1,9 @@
 """Memory monitoring utilities for the runtime."""
 
+import asyncio
+import os
 import threading
+import time
 
 from memory_profiler import memory_usage
 
@@ -64,3 +67,112 @@ class MemoryMonitor:
             self._stop_monitoring.set()
             self._monitoring_thread = None
             logger.info('Memory monitoring stopped')
+
+
+class ResourceGovernor:
+    """Adaptive resource governor for the action execution server.
+
+    Enforces a per-action output budget by spilling oversized observation
+    content to disk (the event keeps a head/tail excerpt plus a reference to
+    the spill file, readable later through the file viewer), and throttles
+    the admission of new actions while the sandbox is under memory pressure -
+    so runaway output degrades gracefully instead of OOMing the container.
+    """
+
+    # Per-action observation content budget, in bytes
+    DEFAULT_OUTPUT_BUDGET_BYTES = 2 * 1024 * 1024
+    # How much of the budget to keep inline at the head / tail of the content
+    EXCERPT_BYTES = 32 * 1024
+    # Fraction of system memory at which new actions are throttled
+    DEFAULT_PRESSURE_THRESHOLD = 0.90
+    # Longest a single action is delayed by throttling
+    MAX_THROTTLE_SECONDS = 30.0
+
+    def __init__(
+        self,
+        spill_dir: str,
+        output_budget_bytes: int | None = None,
+        pressure_threshold: float | None = None,
+    ):
+        self.spill_dir = spill_dir
+        self.output_budget_bytes = output_budget_bytes or int(
+            os.environ.get(
+                'RUNTIME_OUTPUT_BUDGET_BYTES', self.DEFAULT_OUTPUT_BUDGET_BYTES
+            )
+        )
+        self.pressure_threshold = pressure_threshold or float(
+            os.environ.get(
+                'RUNTIME_MEMORY_PRESSURE_THRESHOLD', self.DEFAULT_PRESSURE_THRESHOLD
+            )
+        )
+        self._spill_counter = 0
+
+    def memory_pressure(self) -> float:
+        """Fraction of system memory currently in use (0.0 when unknown)."""
+        try:
+            import psutil
+
+            return psutil.virtual_memory().percent / 100.0
+        except Exception:
+            return 0.0
+
+    async def throttle(self) -> None:
+        """Delay admission of a new action while memory pressure is high.
+
+        Backs off progressively, giving in-flight actions (and the kernel)
+        time to release memory; gives up after MAX_THROTTLE_SECONDS so an
+        action is delayed, never lost.
+        """
+        waited = 0.0
+        delay = 0.2
+        while waited < self.MAX_THROTTLE_SECONDS:
+            pressure = self.memory_pressure()
+            if pressure < self.pressure_threshold:
+                return
+            logger.warning(
+                f'Memory pressure {pressure:.0%} >= '
+                f'{self.pressure_threshold:.0%}; throttling action admission'
+            )
+            await asyncio.sleep(delay)
+            waited += delay
+            delay = min(delay * 2, 5.0)
+
+    def govern_observation(self, observation):
+        """Spill oversized observation content to disk, keeping an excerpt.
+
+        Returns the observation (mutated in place when spilled).
+        """
+        content = getattr(observation, 'content', None)
+        if not isinstance(content, str):
+            return observation
+        content_bytes = len(content.encode('utf-8', errors='ignore'))
+        if content_bytes <= self.output_budget_bytes:
+            return observation
+        os.makedirs(self.spill_dir, exist_ok=True)
+        self._spill_counter += 1
+        spill_path = os.path.join(
+            self.spill_dir,
+            f'observation_{int(time.time())}_{self._spill_counter:04d}.txt',
+        )
+        try:
+            with open(spill_path, 'w', encoding='utf-8', errors='ignore') as f:
+                f.write(content)
+        except OSError as e:
+            logger.error(f'Failed to spill oversized observation: {e}')
+            return observation
+        # Scale the inline excerpt to the budget so the governed content is
+        # always much smaller than what it replaces
+        excerpt_bytes = min(self.EXCERPT_BYTES, max(1, self.output_budget_bytes // 4))
+        head = content[:excerpt_bytes]
+        tail = content[-excerpt_bytes:]
+        observation.content = (
+            f'{head}\n'
+            f'[... output of {content_bytes:,} bytes exceeded the '
+            f'{self.output_budget_bytes:,} byte budget. '
+            f'Full output saved to: {spill_path} ...]\n'
+            f'{tail}'
+        )
+        logger.warning(
+            f'Spilled {content_bytes:,} byte observation to {spill_path}'
+        )
+        return observation
@@ -0,0 +1,113 @@
+"""Speculative prefetch of read-only runtime results.
+
+While the LLM is thinking, the runtime is idle - but the files the agent
+recently read are the most likely targets of its next reads. The prefetcher
+re-fetches those files in a background thread right after each action
+completes, and Runtime._handle_action serves the next matching FileReadAction
+from the cache instead of paying a runtime round trip.
+
+Correctness first: only FileReadActions are ever served from the cache, and
+any action that can mutate state (commands, edits, browsing, MCP calls)
+clears it, so a speculative result can never mask a write made by the agent.
+A process left running in the background can still modify files during the
+think-time gap without invalidating the cache - which is why the prefetcher
+is opt-in (RUNTIME_READ_PREFETCH=true).
+"""
+
+import copy
+import threading
+import time
+from collections import OrderedDict
+from typing import Callable
+
+from openhands.core.logger import openhands_logger as logger
+from openhands.events.action import Action
+from openhands.events.action.files import FileReadAction
+from openhands.events.observation import ErrorObservation, Observation
+
+
+class ReadPrefetcher:
+    # How many distinct recent reads to speculatively refresh
+    MAX_TRACKED_READS = 8
+    # A prefetched result older than this is never served
+    TTL_SECONDS = 60.0
+
+    def __init__(self, run_action_fn: Callable[[Action], Observation]):
+        self._run_action = run_action_fn
+        self._recent_reads: OrderedDict[tuple, FileReadAction] = OrderedDict()
+        self._cache: dict[tuple, tuple[Observation, float]] = {}
+        self._lock = threading.Lock()
+        self._prefetch_thread: threading.Thread | None = None
+        # Monotonic generation, bumped on invalidation so an in-flight
+        # prefetch can't repopulate the cache with pre-invalidation data
+        self._generation = 0
+
+    @staticmethod
+    def _key(action: FileReadAction) -> tuple:
+        return (
+            action.path,
+            getattr(action, 'start', None),
+            getattr(action, 'end', None),
+            getattr(action, 'impl_source', None),
+        )
+
+    def on_action(self, action: Action) -> Observation | None:
+        """Consult the cache before executing an action.
+
+        Returns a fresh prefetched observation for a matching read, or None.
+        Mutating actions invalidate the cache.
+        """
+        if isinstance(action, FileReadAction):
+            key = self._key(action)
+            with self._lock:
+                self._recent_reads[key] = action
+                self._recent_reads.move_to_end(key)
+                while len(self._recent_reads) > self.MAX_TRACKED_READS:
+                    self._recent_reads.popitem(last=False)
+                entry = self._cache.pop(key, None)
+            if entry is not None:
+                observation, fetched_at = entry
+                if time.monotonic() - fetched_at < self.TTL_SECONDS:
+                    logger.debug(f'Serving prefetched read for {action.path}')
+                    return copy.deepcopy(observation)
+            return None
+        # Anything else may change the filesystem - drop speculative state
+        with self._lock:
+            self._generation += 1
+            self._cache.clear()
+        return None
+
+    def after_action(self) -> None:
+        """Kick a background refresh of the recently read files.
+
+        Called after an observation is delivered, i.e. right when the agent
+        starts its next LLM call and the runtime goes idle.
+        """
+        with self._lock:
+            if not self._recent_reads:
+                return
+            if self._prefetch_thread is not None and self._prefetch_thread.is_alive():
+                return
+            actions = list(self._recent_reads.values())
+            generation = self._generation
+        thread = threading.Thread(
+            target=self._prefetch, args=(actions, generation), daemon=True
+        )
+        self._prefetch_thread = thread
+        thread.start()
+
+    def _prefetch(self, actions: list[FileReadAction], generation: int) -> None:
+        for action in actions:
+            try:
+                observation = self._run_action(copy.deepcopy(action))
+            except Exception:
+                logger.debug(
+                    f'Prefetch failed for {action.path}', exc_info=True
+                )
+                continue
+            if isinstance(observation, ErrorObservation):
+                continue
+            with self._lock:
+                if self._generation != generation:
+                    return  # a mutating action ran - results are stale
+                self._cache[self._key(action)] = (observation, time.monotonic())
@@ -4,6 +4,8 @@ import os
 import shutil
 import string
 import tempfile
+import time
+from contextlib import contextmanager
 from enum import Enum
 from pathlib import Path
 
@@ -24,6 +26,21 @@ class BuildFromImageType(Enum):
     LOCK = 'lock'  # Fastest: Reuse the most recent image with the exact SAME dependencies (lock files)
 
 
+# Per-stage wall times of the most recent build in this process, for release
+# tooling and regression tracking
+LAST_BUILD_TIMINGS: dict[str, float] = {}
+
+
+@contextmanager
+def _build_stage(name: str):
+    """Record the wall time of one build stage into LAST_BUILD_TIMINGS."""
+    start = time.monotonic()
+    try:
+        yield
+    finally:
+        LAST_BUILD_TIMINGS[name] = round(time.monotonic() - start, 3)
+
+
 def get_runtime_image_repo() -> str:
     return os.getenv('OH_RUNTIME_RUNTIME_IMAGE_REPO', 'ghcr.io/openhands/runtime')
 
@@ -176,16 +193,17 @@ def build_runtime_image_in_folder(
     extra_build_args: list[str] | None = None,
     enable_browser: bool = True,
 ) -> str:
+    LAST_BUILD_TIMINGS.clear()
     runtime_image_repo, _ = get_runtime_image_repo_and_tag(base_image)
-    lock_tag = (
-        f'oh_v{get_version()}_{get_hash_for_lock_files(base_image, enable_browser)}'
-    )
+    with _build_stage('hash_lock_files'):
+        lock_tag = f'oh_v{get_version()}_{get_hash_for_lock_files(base_image, enable_browser)}'
     versioned_tag = (
         # truncate the base image to 96 characters to fit in the tag max length (128 characters)
         f'oh_v{get_version()}_{get_tag_for_versioned_image(base_image)}'
     )
     versioned_image_name = f'{runtime_image_repo}:{versioned_tag}'
-    source_tag = f'{lock_tag}_{get_hash_for_source_files()}'
+    with _build_stage('hash_source_files'):
+        source_tag = f'{lock_tag}_{get_hash_for_source_files()}'
     hash_image_name = f'{runtime_image_repo}:{source_tag}'
 
     logger.info(f'Building image: {hash_image_name}')
@@ -216,47 +234,64 @@ def build_runtime_image_in_folder(
     lock_image_name = f'{runtime_image_repo}:{lock_tag}'
     build_from = BuildFromImageType.SCRATCH
 
-    # If the exact image already exists, we do not need to build it
-    if runtime_builder.image_exists(hash_image_name, False):
-        logger.debug(f'Reusing Image [{hash_image_name}]')
-        return hash_image_name
+    with _build_stage('layer_lookup'):
+        # If the exact image already exists, we do not need to build it
+        if runtime_builder.image_exists(hash_image_name, False):
+            logger.debug(f'Reusing Image [{hash_image_name}]')
+            _log_build_timings(hash_image_name, 'reused')
+            return hash_image_name
+
+        # We look for an existing image that shares the same lock_tag (pulled
+        # from the registry when not present locally). If such an image
+        # exists, we can use it as the base image for the build and just copy
+        # source files. This makes the build much faster.
+        if runtime_builder.image_exists(lock_image_name):
+            logger.debug(
+                f'Build [{hash_image_name}] from lock image [{lock_image_name}]'
+            )
+            build_from = BuildFromImageType.LOCK
+            base_image = lock_image_name
+        elif runtime_builder.image_exists(versioned_image_name):
+            logger.info(
+                f'Build [{hash_image_name}] from versioned image [{versioned_image_name}]'
+            )
+            build_from = BuildFromImageType.VERSIONED
+            base_image = versioned_image_name
+        else:
+            logger.debug(f'Build [{hash_image_name}] from scratch')
 
-    # We look for an existing image that shares the same lock_tag. If such an image exists, we
-    # can use it as the base image for the build and just copy source files. This makes the build
-    # much faster.
-    if runtime_builder.image_exists(lock_image_name):
-        logger.debug(f'Build [{hash_image_name}] from lock image [{lock_image_name}]')
-        build_from = BuildFromImageType.LOCK
-        base_image = lock_image_name
-    elif runtime_builder.image_exists(versioned_image_name):
-        logger.info(
-            f'Build [{hash_image_name}] from versioned image [{versioned_image_name}]'
+    with _build_stage('prep_build_folder'):
+        prep_build_folder(
+            build_folder, base_image, build_from, extra_deps, enable_browser
         )
-        build_from = BuildFromImageType.VERSIONED
-        base_image = versioned_image_name
-    else:
-        logger.debug(f'Build [{hash_image_name}] from scratch')
-
-    prep_build_folder(build_folder, base_image, build_from, extra_deps, enable_browser)
     if not dry_run:
-        _build_sandbox_image(
-            build_folder,
-            runtime_builder,
-            runtime_image_repo,
-            source_tag=source_tag,
-            lock_tag=lock_tag,
-            # Only tag the versioned image if we are building from scratch.
-            # This avoids too much layers when you lay one image on top of another multiple times
-            versioned_tag=(
-                versioned_tag if build_from == BuildFromImageType.SCRATCH else None
-            ),
-            platform=platform,
-            extra_build_args=extra_build_args,
-        )
+        with _build_stage('docker_build'):
+            _build_sandbox_image(
+                build_folder,
+                runtime_builder,
+                runtime_image_repo,
+                source_tag=source_tag,
+                lock_tag=lock_tag,
+                # Only tag the versioned image if we are building from scratch.
+                # This avoids too much layers when you lay one image on top of another multiple times
+                versioned_tag=(
+                    versioned_tag if build_from == BuildFromImageType.SCRATCH else None
+                ),
+                platform=platform,
+                extra_build_args=extra_build_args,
+            )
 
+    _log_build_timings(hash_image_name, build_from.value)
     return hash_image_name
 
 
+def _log_build_timings(image_name: str, build_kind: str) -> None:
+    stages = ', '.join(
+        f'{name}={seconds}s' for name, seconds in LAST_BUILD_TIMINGS.items()
+    )
+    logger.info(f'Runtime image build [{image_name}] ({build_kind}): {stages}')
+
+
 def prep_build_folder(
     build_folder: Path,
     base_image: str,
@@ -341,8 +376,37 @@ def get_tag_for_versioned_image(base_image: str) -> str:
     return base_image.replace('/', '_s_').replace(':', '_t_').lower()[-96:]
 
 
+# Source-hash memoization: dirhash walks the whole source tree, which is
+# wasteful when nothing changed between builds in one process. The cache key
+# is a cheap (file count, newest mtime) scan.
+_source_hash_cache: tuple[tuple[int, float, int], str] | None = None
+
+
+def _source_tree_fingerprint(source_dir: Path) -> tuple[int, float, int]:
+    file_count = 0
+    newest_mtime = 0.0
+    total_size = 0
+    for root, dirs, files in os.walk(source_dir):
+        dirs[:] = [d for d in dirs if not d.startswith('.') and d != '__pycache__']
+        for name in files:
+            if name.endswith('.pyc'):
+                continue
+            file_count += 1
+            try:
+                stat = os.stat(os.path.join(root, name))
+            except OSError:
+                continue
+            newest_mtime = max(newest_mtime, stat.st_mtime)
+            total_size += stat.st_size
+    return file_count, newest_mtime, total_size
+
+
 def get_hash_for_source_files() -> str:
+    global _source_hash_cache
     openhands_source_dir = Path(openhands.__file__).parent
+    fingerprint = _source_tree_fingerprint(openhands_source_dir)
+    if _source_hash_cache is not None and _source_hash_cache[0] == fingerprint:
+        return _source_hash_cache[1]
     dir_hash = dirhash(
         openhands_source_dir,
         'md5',
@@ -355,6 +419,7 @@ def get_hash_for_source_files() -> str:
     # We get away with truncation because we want something that is unique
     # rather than something that is cryptographically secure
     result = truncate_hash(dir_hash)
+    _source_hash_cache = (fingerprint, result)
     return result
 
 
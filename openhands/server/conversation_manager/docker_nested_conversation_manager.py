@@ -169,8 +169,11 @@ class DockerNestedConversationManager(ConversationManager):
                 self._starting_conversation_ids.discard(sid)
                 return
 
-            # initialize the container but dont wait for it to start
-            await call_sync_from_async(runtime.init_container)
+            # initialize the container but dont wait for it to start - a
+            # pre-booted container from the warm pool skips the cold start
+            # entirely (possible when no per-conversation volumes are mounted)
+            if not await call_sync_from_async(runtime.try_adopt_warm_container):
+                await call_sync_from_async(runtime.init_container)
 
             # Start the conversation in a background task.
             asyncio.create_task(
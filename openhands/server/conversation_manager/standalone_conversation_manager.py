@@ -1,8 +1,9 @@
 import asyncio
+import heapq
 import time
 from dataclasses import dataclass, field
 from datetime import datetime, timezone
-from typing import Any, Callable, Iterable
+from typing import Any, Callable
 
 import socketio
 
@@ -46,6 +47,9 @@ from openhands.utils.utils import create_registry_and_conversation_stats
 from .conversation_manager import ConversationManager
 
 _CLEANUP_INTERVAL = 15
+# Grace period before a detached conversation is disconnected, during which it
+# can be reattached (matches the old cleanup sweep cadence)
+_DETACHED_DISCONNECT_DELAY = _CLEANUP_INTERVAL
 UPDATED_AT_CALLBACK_ID = 'updated_at_callback_id'
 
 
@@ -74,11 +78,20 @@ class StandaloneConversationManager(ConversationManager):
     _cleanup_task: asyncio.Task | None = None
     _conversation_store_class: type[ConversationStore] | None = None
     _loop: asyncio.AbstractEventLoop | None = None
+    # Expiry heap entries are (deadline, kind, sid) with kind 'session' or
+    # 'detached'. Entries are never removed eagerly - the scheduler drops the
+    # ones that no longer apply when they fire (lazy deletion).
+    _expiry_heap: list[tuple[float, str, str]] = field(default_factory=list)
+    _expiry_wakeup: asyncio.Event = field(default_factory=asyncio.Event)
+    # Secondary indexes so get_connections / get_running_agent_loops do not
+    # scan every entry.
+    _connection_ids_by_sid: dict[str, set[str]] = field(default_factory=dict)
+    _sids_by_user_id: dict[str | None, set[str]] = field(default_factory=dict)
 
     async def __aenter__(self):
         # Grab a reference to the main event loop. This is the loop in which `await sio.emit` must be called
         self._loop = asyncio.get_event_loop()
-        self._cleanup_task = asyncio.create_task(self._cleanup_stale())
+        self._cleanup_task = asyncio.create_task(self._run_expiry_scheduler())
         get_runtime_cls(self.config.runtime).setup(self.config)
         return self
 
@@ -161,6 +174,7 @@ class StandaloneConversationManager(ConversationManager):
         )
         await self.sio.enter_room(connection_id, ROOM_KEY.format(sid=sid))
         self._local_connection_id_to_session_id[connection_id] = sid
+        self._connection_ids_by_sid.setdefault(sid, set()).add(connection_id)
         agent_loop_info = await self.maybe_start_agent_loop(sid, settings, user_id)
         return agent_loop_info
 
@@ -175,45 +189,46 @@ class StandaloneConversationManager(ConversationManager):
                 else:
                     self._active_conversations.pop(sid)
                     self._detached_conversations[sid] = (conversation, time.time())
+                    self._schedule_expiry(
+                        time.time() + _DETACHED_DISCONNECT_DELAY, 'detached', sid
+                    )
 
-    async def _cleanup_stale(self):
-        while should_continue():
-            try:
-                async with self._conversations_lock:
-                    # Create a list of items to process to avoid modifying dict during iteration
-                    items = list(self._detached_conversations.items())
-                    for sid, (conversation, detach_time) in items:
-                        await conversation.disconnect()
-                        self._detached_conversations.pop(sid, None)
+    def _schedule_expiry(self, deadline: float, kind: str, sid: str) -> None:
+        """Queue a lifecycle check for a session at the given time."""
+        heapq.heappush(self._expiry_heap, (deadline, kind, sid))
+        self._expiry_wakeup.set()
 
-                # Implies disconnected sandboxes stay open indefinitely
-                if not self.config.sandbox.close_delay:
-                    return
+    async def _run_expiry_scheduler(self):
+        """Fire lifecycle checks exactly when they come due.
 
-                close_threshold = time.time() - self.config.sandbox.close_delay
-                running_loops = list(self._local_agent_loops_by_sid.items())
-                running_loops.sort(key=lambda item: item[1].last_active_ts)
-                sid_to_close: list[str] = []
-                for sid, session in running_loops:
-                    state = session.agent_session.get_state()
-                    if session.last_active_ts < close_threshold and state not in [
-                        AgentState.RUNNING,
-                        None,
-                    ]:
-                        sid_to_close.append(sid)
-
-                connections = await self.get_connections(
-                    filter_to_sids=set(sid_to_close)  # get_connections expects a set
-                )
-                connected_sids = {sid for _, sid in connections.items()}
-                sid_to_close = [
-                    sid for sid in sid_to_close if sid not in connected_sids
-                ]
-                await wait_all(
-                    (self._close_session(sid) for sid in sid_to_close),
-                    timeout=WAIT_TIME_BEFORE_CLOSE,
-                )
-                await asyncio.sleep(_CLEANUP_INTERVAL)
+        Sessions are scheduled at their earliest possible expiry; if there was
+        activity in the meantime the check simply reschedules itself for the
+        corrected deadline, so no periodic sweep over all sessions is needed.
+        """
+        while should_continue():
+            try:
+                now = time.time()
+                while self._expiry_heap and self._expiry_heap[0][0] <= now:
+                    _, kind, sid = heapq.heappop(self._expiry_heap)
+                    if kind == 'detached':
+                        await self._disconnect_detached_conversation(sid)
+                    else:
+                        await self._maybe_close_idle_session(sid)
+                    now = time.time()
+                if self._expiry_heap:
+                    timeout = self._expiry_heap[0][0] - time.time()
+                else:
+                    timeout = None
+                self._expiry_wakeup.clear()
+                try:
+                    if timeout is None:
+                        await self._expiry_wakeup.wait()
+                    elif timeout > 0:
+                        await asyncio.wait_for(
+                            self._expiry_wakeup.wait(), timeout=timeout
+                        )
+                except asyncio.TimeoutError:
+                    pass
             except asyncio.CancelledError:
                 async with self._conversations_lock:
                     for conversation, _ in self._detached_conversations.values():
@@ -227,6 +242,40 @@ class StandaloneConversationManager(ConversationManager):
                 logger.error('error_cleaning_stale')
                 await asyncio.sleep(_CLEANUP_INTERVAL)
 
+    async def _disconnect_detached_conversation(self, sid: str) -> None:
+        async with self._conversations_lock:
+            item = self._detached_conversations.pop(sid, None)
+            if item:
+                await item[0].disconnect()
+
+    async def _maybe_close_idle_session(self, sid: str) -> None:
+        """Close a session whose idle deadline has passed, or reschedule it."""
+        # Implies disconnected sandboxes stay open indefinitely
+        if not self.config.sandbox.close_delay:
+            return
+        session = self._local_agent_loops_by_sid.get(sid)
+        if session is None:
+            return  # Already closed - stale heap entry
+        deadline = session.last_active_ts + self.config.sandbox.close_delay
+        now = time.time()
+        if deadline > now:
+            # There was activity since this entry was scheduled
+            self._schedule_expiry(deadline, 'session', sid)
+            return
+        state = session.agent_session.get_state()
+        if state in (AgentState.RUNNING, None):
+            self._schedule_expiry(
+                now + self.config.sandbox.close_delay, 'session', sid
+            )
+            return
+        connections = await self.get_connections(filter_to_sids={sid})
+        if connections:
+            self._schedule_expiry(
+                now + self.config.sandbox.close_delay, 'session', sid
+            )
+            return
+        await wait_all((self._close_session(sid),), timeout=WAIT_TIME_BEFORE_CLOSE)
+
     async def _get_conversation_store(self, user_id: str | None) -> ConversationStore:
         conversation_store_class = self._conversation_store_class
         if not conversation_store_class:
@@ -248,33 +297,32 @@ class StandaloneConversationManager(ConversationManager):
         Returns:
             A set of session IDs
         """
-        # Get all items and convert to list for sorting
-        items: Iterable[tuple[str, Session]] = self._local_agent_loops_by_sid.items()
-
-        # Filter items if needed
-        if filter_to_sids is not None:
-            items = (item for item in items if item[0] in filter_to_sids)
         if user_id:
-            items = (item for item in items if item[1].user_id == user_id)
-
-        sids = {sid for sid, _ in items}
+            sids = set(self._sids_by_user_id.get(user_id, ()))
+        else:
+            sids = set(self._local_agent_loops_by_sid.keys())
+        if filter_to_sids is not None:
+            sids &= filter_to_sids
         return sids
 
     async def get_connections(
         self, user_id: str | None = None, filter_to_sids: set[str] | None = None
     ) -> dict[str, str]:
-        connections = dict(**self._local_connection_id_to_session_id)
         if filter_to_sids is not None:
             connections = {
                 connection_id: sid
-                for connection_id, sid in connections.items()
-                if sid in filter_to_sids
+                for sid in filter_to_sids
+                for connection_id in self._connection_ids_by_sid.get(sid, ())
             }
+        else:
+            connections = dict(**self._local_connection_id_to_session_id)
         if user_id:
-            for connection_id, sid in list(connections.items()):
-                session = self._local_agent_loops_by_sid.get(sid)
-                if not session or session.user_id != user_id:
-                    connections.pop(connection_id)
+            user_sids = self._sids_by_user_id.get(user_id, set())
+            connections = {
+                connection_id: sid
+                for connection_id, sid in connections.items()
+                if sid in user_sids
+            }
         return connections
 
     async def maybe_start_agent_loop(
@@ -350,6 +398,11 @@ class StandaloneConversationManager(ConversationManager):
             user_id=user_id,
         )
         self._local_agent_loops_by_sid[sid] = session
+        self._sids_by_user_id.setdefault(user_id, set()).add(sid)
+        if self.config.sandbox.close_delay:
+            self._schedule_expiry(
+                time.time() + self.config.sandbox.close_delay, 'session', sid
+            )
         asyncio.create_task(
             session.initialize_agent(settings, initial_user_msg, replay_json)
         )
@@ -406,6 +459,11 @@ class StandaloneConversationManager(ConversationManager):
                 extra={'session_id': sid},
             )
             return
+        connection_ids = self._connection_ids_by_sid.get(sid)
+        if connection_ids is not None:
+            connection_ids.discard(connection_id)
+            if not connection_ids:
+                self._connection_ids_by_sid.pop(sid, None)
 
     async def close_session(self, sid: str):
         session = self._local_agent_loops_by_sid.get(sid)
@@ -430,11 +488,7 @@ class StandaloneConversationManager(ConversationManager):
         logger.info(f'_close_session:{sid}', extra={'session_id': sid})
 
         # Clear up local variables
-        connection_ids_to_remove = list(
-            connection_id
-            for connection_id, conn_sid in self._local_connection_id_to_session_id.items()
-            if sid == conn_sid
-        )
+        connection_ids_to_remove = list(self._connection_ids_by_sid.pop(sid, ()))
         logger.info(
             f'removing connections: {connection_ids_to_remove}',
             extra={'session_id': sid},
@@ -448,6 +502,11 @@ class StandaloneConversationManager(ConversationManager):
         if not session:
             logger.warning(f'no_session_to_close:{sid}', extra={'session_id': sid})
             return
+        user_sids = self._sids_by_user_id.get(session.user_id)
+        if user_sids is not None:
+            user_sids.discard(sid)
+            if not user_sids:
+                self._sids_by_user_id.pop(session.user_id, None)
 
         logger.info(f'closing_session:{session.sid}', extra={'session_id': sid})
         await session.close()
@@ -0,0 +1,66 @@
+import asyncio
+
+from openhands.core.logger import openhands_logger as logger
+
+
+class EventFanout:
+    """Coalescing fan-out for socket.io event delivery.
+
+    Each event is serialized once by the caller; rapid sequences within the
+    flush window are delivered as a single 'oh_event_batch' frame per room
+    instead of one message per event, cutting per-message overhead and
+    making the transport's per-message deflate effective (larger frames
+    compress far better than single events).
+    """
+
+    # How long to wait for more events before flushing a room
+    FLUSH_WINDOW_SECONDS = 0.05
+    # Flush immediately once a room has this many pending events
+    MAX_BATCH_SIZE = 50
+
+    def __init__(self, sio):
+        self.sio = sio
+        self._pending: dict[str, list[dict]] = {}
+        self._flush_tasks: dict[str, asyncio.Task] = {}
+        # Serializes pop+emit so overlapping size- and timer-triggered
+        # flushes can never deliver batches out of order
+        self._flush_lock = asyncio.Lock()
+
+    async def emit_event(self, room: str, data: dict) -> None:
+        """Queue one serialized event for the room, flushing by size or age."""
+        pending = self._pending.setdefault(room, [])
+        pending.append(data)
+        if len(pending) >= self.MAX_BATCH_SIZE:
+            await self._flush(room)
+            return
+        flush_task = self._flush_tasks.get(room)
+        if flush_task is None or flush_task.done():
+            self._flush_tasks[room] = asyncio.create_task(
+                self._delayed_flush(room)
+            )
+
+    async def _delayed_flush(self, room: str) -> None:
+        await asyncio.sleep(self.FLUSH_WINDOW_SECONDS)
+        try:
+            await self._flush(room)
+        except Exception:
+            logger.exception(f'Error flushing event batch for room {room}')
+
+    async def _flush(self, room: str) -> None:
+        async with self._flush_lock:
+            batch = self._pending.pop(room, None)
+            if not batch:
+                return
+            if len(batch) == 1:
+                # Single events keep the existing message shape
+                await self.sio.emit('oh_event', batch[0], to=room)
+            else:
+                await self.sio.emit('oh_event_batch', batch, to=room)
+
+    async def flush_all(self) -> None:
+        """Flush every room immediately (shutdown path)."""
+        for room in list(self._pending.keys()):
+            await self._flush(room)
+        for flush_task in self._flush_tasks.values():
+            flush_task.cancel()
+        self._flush_tasks.clear()
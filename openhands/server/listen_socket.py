@@ -95,7 +95,11 @@ async def connect(connection_id: str, environ: dict) -> None:
 
         # Process all available events
         async for event in async_store:
-            logger.debug(f'oh_event: {event.__class__.__name__}')
+            logger.debug(
+                'oh_event: %s',
+                event.__class__.__name__,
+                extra={'sample_category': 'event'},
+            )
 
             if isinstance(
                 event,
@@ -1,5 +1,6 @@
 from openhands.core.config.openhands_config import OpenHandsConfig
 from openhands.events.event import Event
+from openhands.utils.tracing import TraceSpan
 
 
 class MonitoringListener:
@@ -27,6 +28,14 @@ class MonitoringListener:
         """
         pass
 
+    def on_trace_span(self, span: TraceSpan) -> None:
+        """Receive one timed stage of the agent step pipeline.
+
+        Spans carry conversation/step ids in their attributes. Implementations
+        must be fast and non-blocking - spans are delivered on the traced path.
+        """
+        pass
+
     def on_create_conversation(self) -> None:
         """Track the beginning of conversation creation.
         Does not currently capture whether it succeed.
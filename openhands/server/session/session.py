@@ -30,6 +30,7 @@ from openhands.events.stream import EventStreamSubscriber
 from openhands.llm.llm_registry import LLMRegistry
 from openhands.runtime.runtime_status import RuntimeStatus
 from openhands.server.constants import ROOM_KEY
+from openhands.server.event_fanout import EventFanout
 from openhands.server.services.conversation_stats import ConversationStats
 from openhands.server.session.agent_session import AgentSession
 from openhands.server.session.conversation_init_data import ConversationInitData
@@ -110,6 +111,7 @@ class WebSession:
         self.loop = asyncio.get_event_loop()
         self.user_id = user_id
 
+        self._event_fanout = EventFanout(sio) if sio else None
         self._publish_queue: asyncio.Queue = asyncio.Queue()
         self._monitor_publish_queue_task: asyncio.Task = self.loop.create_task(
             self._monitor_publish_queue()
@@ -117,6 +119,8 @@ class WebSession:
         self._wait_websocket_initial_complete: bool = True
 
     async def close(self) -> None:
+        if self._event_fanout:
+            await self._event_fanout.flush_all()
         if self.sio:
             await self.sio.emit(
                 'oh_event',
@@ -419,7 +423,10 @@ class WebSession:
                     _waiting_times += 1
                     await asyncio.sleep(sleep_duration)
                 self._wait_websocket_initial_complete = False
-                await self.sio.emit('oh_event', data, to=ROOM_KEY.format(sid=self.sid))
+                # Coalesced fan-out: serialized once here, batched per room
+                await self._event_fanout.emit_event(
+                    ROOM_KEY.format(sid=self.sid), data
+                )
 
             await asyncio.sleep(0.001)  # This flushes the data to the client
             self.last_active_ts = int(time.time())
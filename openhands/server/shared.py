@@ -17,6 +17,7 @@ from openhands.storage.files import FileStore
 from openhands.storage.secrets.secrets_store import SecretsStore
 from openhands.storage.settings.settings_store import SettingsStore
 from openhands.utils.import_utils import get_impl
+from openhands.utils.tracing import register_trace_sink
 
 load_dotenv()
 
@@ -58,6 +59,12 @@ MonitoringListenerImpl = get_impl(
 
 monitoring_listener = MonitoringListenerImpl.get_instance(config)
 
+# Deliver agent step pipeline spans to the monitoring listener. Only register
+# when the listener actually implements on_trace_span, so default deployments
+# keep the zero-overhead no-sink fast path.
+if type(monitoring_listener).on_trace_span is not MonitoringListener.on_trace_span:
+    register_trace_sink(monitoring_listener.on_trace_span)
+
 ConversationManagerImpl = get_impl(
     ConversationManager,
     server_config.conversation_manager_class,
@@ -2,6 +2,11 @@ import os
 
 import httpx
 
+from openhands.storage.async_files import (
+    AsyncFileStore,
+    AsyncLocalFileStore,
+    get_async_file_store,
+)
 from openhands.storage.batched_web_hook import BatchedWebHookFileStore
 from openhands.storage.files import FileStore
 from openhands.storage.google_cloud import GoogleCloudFileStore
@@ -0,0 +1,95 @@
+import asyncio
+
+from openhands.storage.files import FileStore
+from openhands.storage.local import LocalFileStore
+from openhands.utils.async_utils import call_sync_from_async
+
+
+class AsyncFileStore:
+    """Async facade over a FileStore, with batched operations.
+
+    The default implementation delegates to the wrapped synchronous store
+    through the executor, running batch members concurrently under a bounded
+    semaphore - the right shape for network-bound backends (S3, Google Cloud).
+    Backends with different trade-offs can subclass and override.
+    """
+
+    # Upper bound on concurrent operations within one batch, so a large batch
+    # does not monopolize the shared thread pool.
+    MAX_CONCURRENCY = 10
+
+    def __init__(self, file_store: FileStore):
+        self.file_store = file_store
+        self._semaphore = asyncio.Semaphore(self.MAX_CONCURRENCY)
+
+    async def write(self, path: str, contents: str | bytes) -> None:
+        await call_sync_from_async(self.file_store.write, path, contents)
+
+    async def read(self, path: str) -> str:
+        return await call_sync_from_async(self.file_store.read, path)
+
+    async def list(self, path: str) -> list[str]:
+        return await call_sync_from_async(self.file_store.list, path)
+
+    async def delete(self, path: str) -> None:
+        await call_sync_from_async(self.file_store.delete, path)
+
+    async def read_many(self, paths: list[str]) -> list[str | None]:
+        """Read several files concurrently.
+
+        Results are returned in path order; missing files yield None instead
+        of raising, so one absent event file does not fail a whole page fetch.
+        """
+
+        async def read_or_none(path: str) -> str | None:
+            async with self._semaphore:
+                try:
+                    return await call_sync_from_async(self.file_store.read, path)
+                except FileNotFoundError:
+                    return None
+
+        return list(await asyncio.gather(*(read_or_none(path) for path in paths)))
+
+    async def write_many(self, items: list[tuple[str, str | bytes]]) -> None:
+        """Write several files concurrently."""
+
+        async def write_one(path: str, contents: str | bytes) -> None:
+            async with self._semaphore:
+                await call_sync_from_async(self.file_store.write, path, contents)
+
+        await asyncio.gather(*(write_one(path, contents) for path, contents in items))
+
+
+class AsyncLocalFileStore(AsyncFileStore):
+    """Async wrapper for LocalFileStore.
+
+    Local disk reads are fast enough that one executor hop doing the whole
+    batch beats one hop (plus scheduling) per file, so the batched operations
+    run in a single thread.
+    """
+
+    async def read_many(self, paths: list[str]) -> list[str | None]:
+        def read_all() -> list[str | None]:
+            results: list[str | None] = []
+            for path in paths:
+                try:
+                    results.append(self.file_store.read(path))
+                except FileNotFoundError:
+                    results.append(None)
+            return results
+
+        return await call_sync_from_async(read_all)
+
+    async def write_many(self, items: list[tuple[str, str | bytes]]) -> None:
+        def write_all() -> None:
+            for path, contents in items:
+                self.file_store.write(path, contents)
+
+        await call_sync_from_async(write_all)
+
+
+def get_async_file_store(file_store: FileStore) -> AsyncFileStore:
+    """Wrap a FileStore in the async facade best suited to its backend."""
+    if isinstance(file_store, LocalFileStore):
+        return AsyncLocalFileStore(file_store)
+    return AsyncFileStore(file_store)
@@ -1,10 +1,13 @@
+import gzip
 import threading
+import time
 from typing import Optional
 
 import httpx
 import tenacity
 
 from openhands.core.logger import openhands_logger as logger
+from openhands.io import json
 from openhands.storage.files import FileStore
 from openhands.utils.async_utils import EXECUTOR
 from openhands.utils.http_session import httpx_verify_option
@@ -12,6 +15,14 @@ from openhands.utils.http_session import httpx_verify_option
 # Constants for batching configuration
 WEBHOOK_BATCH_TIMEOUT_SECONDS = 5.0
 WEBHOOK_BATCH_SIZE_LIMIT_BYTES = 1048576  # 1MB
+# Max webhook deliveries in flight at once
+WEBHOOK_MAX_PARALLEL_DELIVERIES = 4
+# Compress request bodies larger than this
+WEBHOOK_COMPRESSION_THRESHOLD_BYTES = 16384
+# Writers block once batched + in-flight bytes exceed this (backpressure)
+WEBHOOK_BACKPRESSURE_FACTOR = 4
+# Upper bound on how long one write may be held back by backpressure
+WEBHOOK_BACKPRESSURE_MAX_WAIT_SECONDS = 30.0
 
 
 class BatchedWebHookFileStore(FileStore):
@@ -19,8 +30,10 @@ class BatchedWebHookFileStore(FileStore):
 
     This class wraps another FileStore implementation and sends HTTP requests
     to a specified URL when files are written or deleted. Updates are batched
-    and sent together after a certain amount of time or size exceeds a threshold.
-    Time is counted from the last insert.
+    and sent together once the batch reaches the size limit or the oldest
+    queued update reaches the timeout, whichever comes first. Deliveries go
+    out in parallel with bounded concurrency, large payloads are gzipped, and
+    writers are held back (backpressure) when the endpoint cannot keep up.
 
     Attributes:
         file_store: The underlying FileStore implementation
@@ -82,6 +95,13 @@ class BatchedWebHookFileStore(FileStore):
         self._batch = {}  # Maps path -> (operation, content)
         self._batch_timer = None
         self._batch_size = 0
+        # Delivery concurrency / backpressure state
+        self._delivery_semaphore = threading.Semaphore(WEBHOOK_MAX_PARALLEL_DELIVERIES)
+        self._backpressure_cond = threading.Condition(self._batch_lock)
+        self._backpressure_limit_bytes = (
+            self.batch_size_limit_bytes * WEBHOOK_BACKPRESSURE_FACTOR
+        )
+        self._in_flight_bytes = 0
 
     def write(self, path: str, contents: str | bytes) -> None:
         """Write contents to a file and queue a webhook update.
@@ -135,6 +155,26 @@ class BatchedWebHookFileStore(FileStore):
             contents: The contents that were written (None for delete operations)
         """
         with self._batch_lock:
+            # Backpressure: when the endpoint is slow, queued plus in-flight
+            # bytes grow - hold the writer back (bounded) instead of letting
+            # the batch grow without limit
+            deadline = None
+            while (
+                self._batch_size + self._in_flight_bytes
+                >= self._backpressure_limit_bytes
+            ):
+                if deadline is None:
+                    deadline = (
+                        time.monotonic() + WEBHOOK_BACKPRESSURE_MAX_WAIT_SECONDS
+                    )
+                remaining = deadline - time.monotonic()
+                if remaining <= 0:
+                    logger.warning(
+                        'Webhook endpoint is slow; proceeding despite backpressure'
+                    )
+                    break
+                self._backpressure_cond.wait(timeout=remaining)
+
             # Calculate content size
             content_size = 0
             if contents is not None:
@@ -164,17 +204,16 @@ class BatchedWebHookFileStore(FileStore):
                 self._enqueue_batch_from_lock()
                 return
 
-            # Start or reset the timer for sending the batch
-            if self._batch_timer is not None:
-                self._batch_timer.cancel()
-                self._batch_timer = None
-
-            timer = threading.Timer(
-                self.batch_timeout_seconds, self._enqueue_batch_from_timer
-            )
-            timer.daemon = True
-            timer.start()
-            self._batch_timer = timer
+            # Start the age timer on the first insert of a batch: the batch
+            # flushes when the oldest update reaches the timeout, regardless
+            # of how many inserts follow
+            if self._batch_timer is None:
+                timer = threading.Timer(
+                    self.batch_timeout_seconds, self._enqueue_batch_from_timer
+                )
+                timer.daemon = True
+                timer.start()
+                self._batch_timer = timer
 
     def _enqueue_batch_from_timer(self) -> None:
         """Send the batch from the timer thread.
@@ -189,24 +228,49 @@ class BatchedWebHookFileStore(FileStore):
         Uses executor by default, but can perform synchronously by setting background=False
         """
         batch_to_send = self._batch
+        batch_size = self._batch_size
         self._batch = {}
         self._batch_size = 0
         if background:
-            EXECUTOR.submit(self._send_batch, batch_to_send)
+            # Account the bytes as in-flight until delivered, for backpressure
+            self._in_flight_bytes += batch_size
+            EXECUTOR.submit(self._send_batch, batch_to_send, batch_size)
         else:
-            self._send_batch(batch_to_send)
+            self._send_batch(batch_to_send, batch_size, tracked=False)
         # Cancel any pending timer
         if self._batch_timer is not None:
             self._batch_timer.cancel()
             self._batch_timer = None
 
     def _send_batch(
-        self, batch_to_send: dict[str, tuple[str, str | bytes | None]]
+        self,
+        batch_to_send: dict[str, tuple[str, str | bytes | None]],
+        batch_size: int,
+        tracked: bool = True,
     ) -> None:
-        """Send the current batch of updates to the webhook as a single request.
-        This method acquires the batch lock and processes all pending updates in one batch.
+        """Deliver one batch, bounded by the delivery concurrency limit.
+
+        tracked is False for synchronous flushes, which are not counted as
+        in-flight (the caller holds the batch lock).
         """
-        # Process the entire batch in a single request
+        try:
+            if tracked:
+                # Bounded parallelism for background deliveries
+                with self._delivery_semaphore:
+                    self._deliver(batch_to_send)
+            else:
+                # Synchronous flush (shutdown path) holds the batch lock, so
+                # it must not queue behind in-flight deliveries
+                self._deliver(batch_to_send)
+        finally:
+            if tracked:
+                with self._backpressure_cond:
+                    self._in_flight_bytes -= batch_size
+                    self._backpressure_cond.notify_all()
+
+    def _deliver(
+        self, batch_to_send: dict[str, tuple[str, str | bytes | None]]
+    ) -> None:
         if batch_to_send:
             try:
                 self._send_batch_request(batch_to_send)
@@ -256,8 +320,13 @@ class BatchedWebHookFileStore(FileStore):
 
             batch_payload.append(item)
 
-        # Send the batch as a single request
-        response = self.client.post(self.base_url, json=batch_payload)
+        # Send the batch as a single request, compressed when large
+        body = json.dumps(batch_payload).encode('utf-8')
+        headers = {'Content-Type': 'application/json'}
+        if len(body) >= WEBHOOK_COMPRESSION_THRESHOLD_BYTES:
+            body = gzip.compress(body, compresslevel=5)
+            headers['Content-Encoding'] = 'gzip'
+        response = self.client.post(self.base_url, content=body, headers=headers)
         response.raise_for_status()
 
     def flush(self) -> None:
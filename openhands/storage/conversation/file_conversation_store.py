@@ -1,6 +1,8 @@
 from __future__ import annotations
 
+import asyncio
 import json
+import time
 from dataclasses import dataclass
 from pathlib import Path
 
@@ -9,6 +11,7 @@ from pydantic import TypeAdapter
 from openhands.core.config.openhands_config import OpenHandsConfig
 from openhands.core.logger import openhands_logger as logger
 from openhands.storage import get_file_store
+from openhands.storage.async_files import get_async_file_store
 from openhands.storage.conversation.conversation_store import ConversationStore
 from openhands.storage.data_models.conversation_metadata import ConversationMetadata
 from openhands.storage.data_models.conversation_metadata_result_set import (
@@ -19,25 +22,47 @@ from openhands.storage.locations import (
     CONVERSATION_BASE_DIR,
     get_conversation_metadata_filename,
 )
+from openhands.storage.memory import InMemoryFileStore
 from openhands.utils.async_utils import call_sync_from_async
 from openhands.utils.search_utils import offset_to_page_id, page_id_to_offset
 
 conversation_metadata_type_adapter = TypeAdapter(ConversationMetadata)
 
+# In-process cache of conversation indexes, keyed by backend + metadata dir.
+# Store instances are created per request, so the cache lives at module level;
+# save/delete through any instance in this process keeps it fresh, and a short
+# TTL bounds staleness when several server processes share one backend.
+_INDEX_CACHE: dict[str, tuple[dict[str, str], float]] = {}
+_INDEX_CACHE_TTL_SECONDS = 15.0
+# Serializes index mutations per backend+directory, so concurrent writers
+# cannot drop each other's entries through read-modify-write races.
+_INDEX_LOCKS: dict[str, asyncio.Lock] = {}
+
 
 @dataclass
 class FileConversationStore(ConversationStore):
     file_store: FileStore
 
+    INDEX_FILENAME = '.conversation_index.json'
+
     async def save_metadata(self, metadata: ConversationMetadata) -> None:
         json_str = conversation_metadata_type_adapter.dump_json(metadata)
         path = self.get_conversation_metadata_filename(metadata.conversation_id)
         await call_sync_from_async(self.file_store.write, path, json_str)
+        sort_key = _sort_key(metadata)
+
+        def add_entry(entries: dict[str, str]) -> None:
+            entries[metadata.conversation_id] = sort_key
+
+        await self._mutate_index(add_entry)
 
     async def get_metadata(self, conversation_id: str) -> ConversationMetadata:
         path = self.get_conversation_metadata_filename(conversation_id)
         json_str = await call_sync_from_async(self.file_store.read, path)
+        return self._parse_metadata(json_str, path)
 
+    @staticmethod
+    def _parse_metadata(json_str: str, path: str) -> ConversationMetadata:
         # Validate the JSON
         json_obj = json.loads(json_str)
         if 'created_at' not in json_obj:
@@ -47,8 +72,7 @@ class FileConversationStore(ConversationStore):
         if 'github_user_id' in json_obj:
             json_obj.pop('github_user_id')
 
-        result = conversation_metadata_type_adapter.validate_python(json_obj)
-        return result
+        return conversation_metadata_type_adapter.validate_python(json_obj)
 
     async def delete_metadata(self, conversation_id: str) -> None:
         path = str(
@@ -56,6 +80,11 @@ class FileConversationStore(ConversationStore):
         )
         await call_sync_from_async(self.file_store.delete, path)
 
+        def drop_entry(entries: dict[str, str]) -> None:
+            entries.pop(conversation_id, None)
+
+        await self._mutate_index(drop_entry)
+
     async def exists(self, conversation_id: str) -> bool:
         path = self.get_conversation_metadata_filename(conversation_id)
         try:
@@ -69,7 +98,117 @@ class FileConversationStore(ConversationStore):
         page_id: str | None = None,
         limit: int = 20,
     ) -> ConversationMetadataResultSet:
+        """Page through conversations by recency, served from the index.
+
+        Only the metadata files for the requested page are read, instead of
+        one read per conversation the user has ever had.
+        """
+        entries = await self._load_index()
+        ordered_ids = sorted(entries, key=lambda cid: entries[cid], reverse=True)
+        num_conversations = len(ordered_ids)
+        start = page_id_to_offset(page_id)
+        end = min(limit + start, num_conversations)
+        page_ids = ordered_ids[start:end]
+        # One batched fetch for the whole page instead of a read per file
+        contents = await get_async_file_store(self.file_store).read_many(
+            [self.get_conversation_metadata_filename(cid) for cid in page_ids]
+        )
         conversations: list[ConversationMetadata] = []
+        stale_ids: list[str] = []
+        for conversation_id, json_str in zip(page_ids, contents):
+            try:
+                if json_str is None:
+                    raise FileNotFoundError(conversation_id)
+                conversations.append(
+                    self._parse_metadata(
+                        json_str,
+                        self.get_conversation_metadata_filename(conversation_id),
+                    )
+                )
+            except Exception:
+                logger.warning(
+                    f'Could not load conversation metadata: {conversation_id}'
+                )
+                stale_ids.append(conversation_id)
+        if stale_ids:
+            # Self-heal: drop index entries whose metadata is gone
+            def drop_stale(fresh_entries: dict[str, str]) -> None:
+                for conversation_id in stale_ids:
+                    fresh_entries.pop(conversation_id, None)
+
+            await self._mutate_index(drop_stale)
+        next_page_id = offset_to_page_id(end, end < num_conversations)
+        return ConversationMetadataResultSet(conversations, next_page_id)
+
+    def _index_cache_key(self) -> str | None:
+        """Cache key for the index, or None when caching is unsafe.
+
+        InMemory stores are ephemeral and per-instance, so their indexes are
+        never shared through the module-level cache.
+        """
+        if isinstance(self.file_store, InMemoryFileStore):
+            return None
+        root = getattr(self.file_store, 'root', '')
+        return (
+            f'{type(self.file_store).__name__}:{root}:'
+            f'{self.get_conversation_metadata_dir()}'
+        )
+
+    def _index_path(self) -> str:
+        metadata_dir = self.get_conversation_metadata_dir().rstrip('/')
+        return f'{metadata_dir}/{self.INDEX_FILENAME}'
+
+    def _index_lock(self) -> asyncio.Lock:
+        lock_key = self._index_cache_key() or f'instance:{id(self.file_store)}'
+        lock = _INDEX_LOCKS.get(lock_key)
+        if lock is None:
+            lock = _INDEX_LOCKS.setdefault(lock_key, asyncio.Lock())
+        return lock
+
+    async def _mutate_index(self, mutate) -> None:
+        """Apply a mutation to a freshly read index, under the lock.
+
+        Reading the index again inside the lock (instead of mutating a cached
+        copy) means two interleaved writers merge rather than overwrite each
+        other's entries."""
+        async with self._index_lock():
+            entries = await self._read_index_entries()
+            mutate(entries)
+            await self._save_index(entries)
+
+    async def _load_index(self) -> dict[str, str]:
+        """conversation_id -> sortable created_at, cached in process."""
+        cache_key = self._index_cache_key()
+        if cache_key is not None:
+            cached = _INDEX_CACHE.get(cache_key)
+            if cached and time.monotonic() - cached[1] < _INDEX_CACHE_TTL_SECONDS:
+                return cached[0]
+        async with self._index_lock():
+            entries = await self._read_index_entries()
+            # Recover conversations another writer may have lost from the
+            # index: anything on disk but missing from the entries is re-added
+            if await self._reconcile_index(entries):
+                await self._save_index(entries)
+        if cache_key is not None:
+            _INDEX_CACHE[cache_key] = (entries, time.monotonic())
+        return entries
+
+    async def _read_index_entries(self) -> dict[str, str]:
+        try:
+            content = await call_sync_from_async(
+                self.file_store.read, self._index_path()
+            )
+            return json.loads(content).get('entries', {})
+        except FileNotFoundError:
+            return await self._rebuild_index()
+        except Exception:
+            logger.warning('Discarding unreadable conversation index; rebuilding')
+            return await self._rebuild_index()
+
+    async def _reconcile_index(self, entries: dict[str, str]) -> bool:
+        """Add conversations on disk that the index does not know about.
+
+        Returns True when entries were added."""
         metadata_dir = self.get_conversation_metadata_dir()
         try:
             conversation_ids = [
@@ -78,22 +217,72 @@ class FileConversationStore(ConversationStore):
                 if not Path(path).name.startswith('.')
             ]
         except FileNotFoundError:
-            return ConversationMetadataResultSet([])
-        num_conversations = len(conversation_ids)
-        start = page_id_to_offset(page_id)
-        end = min(limit + start, num_conversations)
-        conversations = []
-        for conversation_id in conversation_ids:
+            return False
+        missing_ids = [cid for cid in conversation_ids if cid not in entries]
+        if not missing_ids:
+            return False
+        contents = await get_async_file_store(self.file_store).read_many(
+            [self.get_conversation_metadata_filename(cid) for cid in missing_ids]
+        )
+        added = False
+        for conversation_id, json_str in zip(missing_ids, contents):
+            if json_str is None:
+                continue
+            try:
+                metadata = self._parse_metadata(
+                    json_str,
+                    self.get_conversation_metadata_filename(conversation_id),
+                )
+            except Exception:
+                continue
+            entries[conversation_id] = _sort_key(metadata)
+            added = True
+        return added
+
+    async def _rebuild_index(self) -> dict[str, str]:
+        """One full scan, amortized over every later page load."""
+        metadata_dir = self.get_conversation_metadata_dir()
+        entries: dict[str, str] = {}
+        try:
+            conversation_ids = [
+                Path(path).name
+                for path in self.file_store.list(metadata_dir)
+                if not Path(path).name.startswith('.')
+            ]
+        except FileNotFoundError:
+            return entries
+        contents = await get_async_file_store(self.file_store).read_many(
+            [
+                self.get_conversation_metadata_filename(conversation_id)
+                for conversation_id in conversation_ids
+            ]
+        )
+        for conversation_id, json_str in zip(conversation_ids, contents):
             try:
-                conversations.append(await self.get_metadata(conversation_id))
+                if json_str is None:
+                    raise FileNotFoundError(conversation_id)
+                metadata = self._parse_metadata(
+                    json_str,
+                    self.get_conversation_metadata_filename(conversation_id),
+                )
             except Exception:
                 logger.warning(
                     f'Could not load conversation metadata: {conversation_id}'
                 )
-        conversations.sort(key=_sort_key, reverse=True)
-        conversations = conversations[start:end]
-        next_page_id = offset_to_page_id(end, end < num_conversations)
-        return ConversationMetadataResultSet(conversations, next_page_id)
+                continue
+            entries[conversation_id] = _sort_key(metadata)
+        await self._save_index(entries)
+        return entries
+
+    async def _save_index(self, entries: dict[str, str]) -> None:
+        cache_key = self._index_cache_key()
+        if cache_key is not None:
+            _INDEX_CACHE[cache_key] = (entries, time.monotonic())
+        await call_sync_from_async(
+            self.file_store.write,
+            self._index_path(),
+            json.dumps({'entries': entries}),
+        )
 
     def get_conversation_metadata_dir(self) -> str:
         return CONVERSATION_BASE_DIR
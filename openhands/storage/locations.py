@@ -18,6 +18,26 @@ def get_conversation_event_filename(
     return f'{get_conversation_events_dir(sid, user_id)}{id}.json'
 
 
+def get_conversation_event_log_dir(sid: str, user_id: str | None = None) -> str:
+    return f'{get_conversation_dir(sid, user_id)}event_log/'
+
+
+def get_conversation_event_log_segment_filename(
+    sid: str, base: int, user_id: str | None = None
+) -> str:
+    return f'{get_conversation_event_log_dir(sid, user_id)}{base}.jsonl'
+
+
+def get_conversation_event_log_index_filename(
+    sid: str, base: int, user_id: str | None = None
+) -> str:
+    return f'{get_conversation_event_log_dir(sid, user_id)}{base}.idx.json'
+
+
+def get_conversation_event_index_filename(sid: str, user_id: str | None = None) -> str:
+    return f'{get_conversation_dir(sid, user_id)}event_index.json'
+
+
 def get_conversation_metadata_filename(sid: str, user_id: str | None = None) -> str:
     return f'{get_conversation_dir(sid, user_id)}metadata.json'
 
@@ -30,6 +50,16 @@ def get_conversation_agent_state_filename(sid: str, user_id: str | None = None)
     return f'{get_conversation_dir(sid, user_id)}agent_state.pkl'
 
 
+def get_conversation_agent_state_delta_dir(sid: str, user_id: str | None = None) -> str:
+    return f'{get_conversation_dir(sid, user_id)}agent_state_deltas/'
+
+
+def get_conversation_agent_state_delta_filename(
+    sid: str, seq: int, user_id: str | None = None
+) -> str:
+    return f'{get_conversation_agent_state_delta_dir(sid, user_id)}{seq:06d}.pkl'
+
+
 def get_conversation_llm_registry_filename(sid: str, user_id: str | None = None) -> str:
     return f'{get_conversation_dir(sid, user_id)}llm_registry.json'
 
@@ -1,8 +1,12 @@
+import io
 import os
 from typing import Any, TypedDict
 
 import boto3
 import botocore
+import botocore.config
+from boto3.exceptions import S3UploadFailedError
+from boto3.s3.transfer import TransferConfig
 
 from openhands.storage.files import FileStore
 
@@ -20,6 +24,9 @@ class ListObjectsV2OutputDict(TypedDict):
 
 
 class S3FileStore(FileStore):
+    # Objects at or above this size use multipart transfers
+    MULTIPART_THRESHOLD = 8 * 1024 * 1024
+
     def __init__(self, bucket_name: str | None) -> None:
         access_key = os.getenv('AWS_ACCESS_KEY_ID')
         secret_key = os.getenv('AWS_SECRET_ACCESS_KEY')
@@ -28,12 +35,24 @@ class S3FileStore(FileStore):
         if bucket_name is None:
             bucket_name = os.environ['AWS_S3_BUCKET']
         self.bucket: str = bucket_name
+        max_concurrency = int(os.getenv('AWS_S3_MAX_CONCURRENCY', '10'))
+        self.multipart_threshold = self.MULTIPART_THRESHOLD
+        self._transfer_config = TransferConfig(
+            multipart_threshold=self.MULTIPART_THRESHOLD,
+            multipart_chunksize=self.MULTIPART_THRESHOLD,
+            max_concurrency=max_concurrency,
+        )
         self.client: Any = boto3.client(
             's3',
             aws_access_key_id=access_key,
             aws_secret_access_key=secret_key,
             endpoint_url=endpoint,
             use_ssl=secure,
+            # Size the connection pool for part-level parallelism so multipart
+            # transfers and batched reads reuse persistent connections
+            config=botocore.config.Config(
+                max_pool_connections=max(10, max_concurrency * 2)
+            ),
         )
 
     def write(self, path: str, contents: str | bytes) -> None:
@@ -41,7 +60,20 @@ class S3FileStore(FileStore):
             as_bytes = (
                 contents.encode('utf-8') if isinstance(contents, str) else contents
             )
-            self.client.put_object(Bucket=self.bucket, Key=path, Body=as_bytes)
+            if len(as_bytes) >= self.multipart_threshold:
+                # Multipart upload - parts are sent in parallel by s3transfer
+                self.client.upload_fileobj(
+                    io.BytesIO(as_bytes),
+                    self.bucket,
+                    path,
+                    Config=self._transfer_config,
+                )
+            else:
+                self.client.put_object(Bucket=self.bucket, Key=path, Body=as_bytes)
+        except S3UploadFailedError as e:
+            raise FileNotFoundError(
+                f"Error: Failed to write to bucket '{self.bucket}' at path {path}: {e}"
+            )
         except botocore.exceptions.ClientError as e:
             if e.response['Error']['Code'] == 'AccessDenied':
                 raise FileNotFoundError(
@@ -60,6 +92,16 @@ class S3FileStore(FileStore):
             response: GetObjectOutputDict = self.client.get_object(
                 Bucket=self.bucket, Key=path
             )
+            size = response.get('ContentLength') or 0  # type: ignore[attr-defined]
+            if size >= self.multipart_threshold:
+                # Large object - fetch it with parallel ranged GETs instead
+                with response['Body'] as stream:
+                    pass  # discard the single-shot stream
+                buffer = io.BytesIO()
+                self.client.download_fileobj(
+                    self.bucket, path, buffer, Config=self._transfer_config
+                )
+                return buffer.getvalue().decode('utf-8')
             with response['Body'] as stream:
                 return str(stream.read().decode('utf-8'))
         except botocore.exceptions.ClientError as e:
@@ -95,13 +137,17 @@ class S3FileStore(FileStore):
         # prefix="foo", delimiter="/"  yields  []  # :(
         results: set[str] = set()
         prefix_len = len(path)
-        response: ListObjectsV2OutputDict = self.client.list_objects_v2(
-            Bucket=self.bucket, Prefix=path
-        )
-        contents = response.get('Contents')
-        if not contents:
+        # Paginate so prefixes with more than one page of keys are complete;
+        # pages are chained by continuation token, so the client's persistent
+        # connection pool is what keeps this fast.
+        paths: list[str] = []
+        paginator = self.client.get_paginator('list_objects_v2')
+        for page in paginator.paginate(Bucket=self.bucket, Prefix=path):
+            contents = page.get('Contents')
+            if contents:
+                paths.extend(obj['Key'] for obj in contents)
+        if not paths:
             return []
-        paths = [obj['Key'] for obj in contents]
         for sub_path in paths:
             if sub_path == path:
                 continue
@@ -122,11 +168,21 @@ class S3FileStore(FileStore):
                 path = path[:-1]
 
             # Try to delete any child resources (Assume the path is a directory)
-            response = self.client.list_objects_v2(
-                Bucket=self.bucket, Prefix=f'{path}/'
-            )
-            for content in response.get('Contents') or []:
-                self.client.delete_object(Bucket=self.bucket, Key=content['Key'])
+            keys: list[str] = []
+            paginator = self.client.get_paginator('list_objects_v2')
+            for page in paginator.paginate(Bucket=self.bucket, Prefix=f'{path}/'):
+                keys.extend(obj['Key'] for obj in page.get('Contents') or [])
+            # Batched deletes - up to 1000 keys per request
+            for start in range(0, len(keys), 1000):
+                self.client.delete_objects(
+                    Bucket=self.bucket,
+                    Delete={
+                        'Objects': [
+                            {'Key': key} for key in keys[start : start + 1000]
+                        ],
+                        'Quiet': True,
+                    },
+                )
 
             # Next try to delete item as a file
             self.client.delete_object(Bucket=self.bucket, Key=path)
@@ -50,7 +50,9 @@ class HttpSession:
         headers = kwargs.get('headers') or {}
         headers = {**self.headers, **headers}
         kwargs['headers'] = headers
-        logger.debug(f'HttpSession:request called with args {args} and kwargs {kwargs}')
+        # %s-style so the (potentially large) payload repr is only built
+        # when debug logging is actually emitted
+        logger.debug('HttpSession:request called with args %s and kwargs %s', args, kwargs)
         return _get_client().request(*args, **kwargs)
 
     def stream(self, *args, **kwargs):
@@ -0,0 +1,93 @@
+"""Lightweight tracing spans for the agent step pipeline.
+
+Spans carry OpenTelemetry-compatible data (name, wall-clock start/end in
+nanoseconds, attributes) and are delivered synchronously to registered sinks;
+the server registers its MonitoringListener as a sink, and
+`register_opentelemetry_sink` forwards spans to an OpenTelemetry tracer.
+
+When no sink is registered, `trace_span` costs a single list truthiness
+check, so instrumentation can stay on in production.
+"""
+
+import time
+from contextlib import contextmanager
+from dataclasses import dataclass, field
+from typing import Any, Callable, Iterator
+
+from openhands.core.logger import openhands_logger as logger
+
+_sinks: list[Callable[['TraceSpan'], None]] = []
+
+
+@dataclass
+class TraceSpan:
+    """One timed stage of the step pipeline."""
+
+    name: str
+    start_time_ns: int
+    end_time_ns: int
+    attributes: dict[str, Any] = field(default_factory=dict)
+    error: str | None = None
+
+    @property
+    def duration_ms(self) -> float:
+        return (self.end_time_ns - self.start_time_ns) / 1_000_000
+
+
+def register_trace_sink(sink: Callable[[TraceSpan], None]) -> None:
+    """Register a callable to receive every completed span.
+
+    Sinks must be fast and non-blocking - they run on the traced path.
+    """
+    if sink not in _sinks:
+        _sinks.append(sink)
+
+
+def unregister_trace_sink(sink: Callable[[TraceSpan], None]) -> None:
+    if sink in _sinks:
+        _sinks.remove(sink)
+
+
+def register_opentelemetry_sink() -> None:
+    """Forward spans to the configured OpenTelemetry tracer provider."""
+    from opentelemetry import trace
+
+    tracer = trace.get_tracer('openhands')
+
+    def otel_sink(span: TraceSpan) -> None:
+        otel_span = tracer.start_span(
+            span.name, start_time=span.start_time_ns, attributes=span.attributes
+        )
+        if span.error:
+            otel_span.set_attribute('error', span.error)
+        otel_span.end(end_time=span.end_time_ns)
+
+    register_trace_sink(otel_sink)
+
+
+@contextmanager
+def trace_span(name: str, **attributes: Any) -> Iterator[None]:
+    """Time a stage of the pipeline and deliver it to the registered sinks."""
+    if not _sinks:
+        yield
+        return
+    start_time_ns = time.time_ns()
+    error: str | None = None
+    try:
+        yield
+    except Exception as e:
+        error = f'{type(e).__name__}: {e}'
+        raise
+    finally:
+        span = TraceSpan(
+            name=name,
+            start_time_ns=start_time_ns,
+            end_time_ns=time.time_ns(),
+            attributes=attributes,
+            error=error,
+        )
+        for sink in list(_sinks):
+            try:
+                sink(span)
+            except Exception:
+                logger.debug(f'Trace sink failed for span {name}', exc_info=True)
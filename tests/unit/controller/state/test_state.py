@@ -1,9 +1,11 @@
 from unittest.mock import patch
 
 from openhands.controller.state.state import State, TrafficControlState
+from openhands.controller.state.state_tracker import StateTracker
 from openhands.core.schema import AgentState
 from openhands.events.event import Event
 from openhands.llm.metrics import Metrics
+from openhands.storage.locations import get_conversation_agent_state_delta_dir
 from openhands.storage.memory import InMemoryFileStore
 
 
@@ -123,3 +125,94 @@ def test_save_without_deprecated_fields():
         restored_state.iteration_flag.current_value == 0
     )  # The depreciated attrib was not stored, so it did not override existing values on restore
     assert restored_state.iteration_flag.max_value == 100
+
+
+def test_delta_persistence_roundtrip():
+    """Deltas written after a snapshot must be replayed on restore."""
+    store = InMemoryFileStore()
+    tracker = StateTracker('test_sid', store, None)
+    tracker.state = State()
+    tracker.save_state()  # first save writes a full snapshot
+
+    tracker.state.last_error = 'boom'
+    tracker.state.agent_state = AgentState.ERROR
+    tracker.save_state()  # second save writes only a delta
+
+    delta_files = store.list(get_conversation_agent_state_delta_dir('test_sid'))
+    assert len(delta_files) == 1
+
+    restored = State.restore_from_session('test_sid', store, None)
+    assert restored.last_error == 'boom'
+
+
+def test_delta_skipped_when_nothing_changed():
+    store = InMemoryFileStore()
+    tracker = StateTracker('test_sid', store, None)
+    tracker.state = State()
+    tracker.save_state()
+    tracker.save_state()  # no changes - no delta should be written
+    try:
+        delta_files = store.list(get_conversation_agent_state_delta_dir('test_sid'))
+    except FileNotFoundError:
+        delta_files = []
+    assert delta_files == []
+
+
+def test_delta_compaction_rewrites_snapshot():
+    store = InMemoryFileStore()
+    tracker = StateTracker('test_sid', store, None)
+    tracker.DELTA_COMPACTION_LIMIT = 3
+    tracker.state = State()
+    tracker.save_state()
+    for i in range(5):
+        tracker.state.last_error = f'error {i}'
+        tracker.save_state()
+
+    # After hitting the limit the deltas are cleared and a snapshot rewritten
+    delta_files = store.list(get_conversation_agent_state_delta_dir('test_sid'))
+    assert len(delta_files) < 5
+    restored = State.restore_from_session('test_sid', store, None)
+    assert restored.last_error == 'error 4'
+
+
+def test_point_in_time_restore():
+    store = InMemoryFileStore()
+    tracker = StateTracker('test_sid', store, None)
+    tracker.state = State()
+    tracker.save_state()
+    for i in range(3):
+        tracker.state.last_error = f'error {i}'
+        tracker.save_state()
+
+    at_first_delta = State.restore_from_session(
+        'test_sid', store, None, max_delta_seq=0
+    )
+    assert at_first_delta.last_error == 'error 0'
+    fully_restored = State.restore_from_session('test_sid', store, None)
+    assert fully_restored.last_error == 'error 2'
+
+
+def test_delta_save_serializes_only_changed_fields():
+    """Unchanged large fields must not be re-pickled into deltas."""
+    store = InMemoryFileStore()
+    tracker = StateTracker('test_sid', store, None)
+    tracker.state = State()
+    tracker.save_state()  # snapshot
+
+    tracker.state.last_error = 'boom'
+    with patch.object(
+        State, 'pickle_fields', wraps=tracker.state.pickle_fields
+    ) as pickle_fields:
+        tracker.save_state()
+    (changed_names,), _ = pickle_fields.call_args
+    assert changed_names == ['last_error']
+
+
+def test_metrics_fingerprint_tracks_accumulation():
+    from openhands.controller.state.state import _field_fingerprint
+
+    metrics = Metrics(model_name='model')
+    before = _field_fingerprint(metrics)
+    assert _field_fingerprint(metrics) == before
+    metrics.add_cost(0.5)
+    assert _field_fingerprint(metrics) != before
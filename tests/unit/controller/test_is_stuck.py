@@ -809,3 +809,101 @@ class TestAgentController:
         controller.delegate = Mock()
         controller.delegate._is_stuck.return_value = True
         assert controller._is_stuck() is True
+
+
+class TestStuckDetectorIncremental:
+    @pytest.fixture
+    def stuck_detector(self):
+        state = State(inputs={})
+        state.iteration_flag.max_value = 50
+        state.history = []
+        return StuckDetector(state)
+
+    def test_screen_skips_full_check_when_tail_differs(
+        self, stuck_detector: StuckDetector
+    ):
+        state = stuck_detector.state
+        for i in range(6):
+            cmd_action = CmdRunAction(command=f'ls {i}')
+            state.history.append(cmd_action)
+            cmd_observation = CmdOutputObservation(
+                command=f'ls {i}', content=f'file_{i}'
+            )
+            state.history.append(cmd_observation)
+
+        with patch.object(
+            stuck_detector, '_check_is_stuck', wraps=stuck_detector._check_is_stuck
+        ) as full_check:
+            assert stuck_detector.is_stuck() is False
+            # The rolling fingerprints rule out every scenario without
+            # re-filtering the history
+            full_check.assert_not_called()
+
+    def test_fingerprints_updated_incrementally(self, stuck_detector: StuckDetector):
+        state = stuck_detector.state
+        for i in range(3):
+            state.history.append(CmdRunAction(command=f'ls {i}'))
+            state.history.append(
+                CmdOutputObservation(command=f'ls {i}', content=f'file_{i}')
+            )
+        assert stuck_detector.is_stuck() is False
+        seen = stuck_detector._seen_history_len
+        assert seen == 6
+
+        # Appending events only ingests the delta
+        state.history.append(CmdRunAction(command='ls 3'))
+        assert stuck_detector.is_stuck() is False
+        assert stuck_detector._seen_history_len == 7
+
+    def test_fingerprints_resync_after_history_rewrite(
+        self, stuck_detector: StuckDetector
+    ):
+        state = stuck_detector.state
+        for i in range(4):
+            state.history.append(CmdRunAction(command=f'ls {i}'))
+        assert stuck_detector.is_stuck() is False
+
+        # Simulate a condensation rewriting the history with repeated events
+        state.history = []
+        for _ in range(4):
+            cmd_action = CmdRunAction(command='ls')
+            state.history.append(cmd_action)
+            cmd_observation = CmdOutputObservation(command='ls', content='file')
+            state.history.append(cmd_observation)
+        assert stuck_detector.is_stuck() is True
+        assert stuck_detector.stuck_analysis is not None
+        assert (
+            stuck_detector.stuck_analysis.loop_type == 'repeating_action_observation'
+        )
+
+    def test_detection_parity_with_full_check(self, stuck_detector: StuckDetector):
+        state = stuck_detector.state
+        for _ in range(4):
+            cmd_action = CmdRunAction(command='ls')
+            state.history.append(cmd_action)
+            cmd_observation = CmdOutputObservation(command='ls', content='file')
+            state.history.append(cmd_observation)
+
+        assert stuck_detector.is_stuck() is True
+        stuck_detector_full = StuckDetector(state)
+        stuck_detector_full.incremental = False
+        assert stuck_detector_full.is_stuck() is True
+
+    def test_condensation_loop_detected_with_interleaved_observations(
+        self, stuck_detector: StuckDetector
+    ):
+        """Adjacent condensation pairs must be detected even when the last
+        two observations are not both condensations."""
+        state = stuck_detector.state
+        # Eight adjacent condensations (many adjacent pairs)...
+        for i in range(8):
+            state.history.append(AgentCondensationObservation(content=f'trim {i}'))
+        # ...then interleaved command output around the 9th and 10th
+        state.history.append(CmdOutputObservation(command='ls', content='file'))
+        state.history.append(AgentCondensationObservation(content='trim 8'))
+        state.history.append(CmdOutputObservation(command='ls', content='file'))
+        state.history.append(AgentCondensationObservation(content='trim 9'))
+
+        assert stuck_detector.is_stuck() is True
+        assert stuck_detector.stuck_analysis is not None
+        assert stuck_detector.stuck_analysis.loop_type == 'context_window_error'
@@ -0,0 +1,91 @@
+import logging
+
+from openhands.core.logger import LazyStr, SamplingFilter
+
+
+def _record(**extra) -> logging.LogRecord:
+    record = logging.LogRecord(
+        name='openhands',
+        level=logging.INFO,
+        pathname=__file__,
+        lineno=1,
+        msg='message',
+        args=(),
+        exc_info=None,
+    )
+    for key, value in extra.items():
+        setattr(record, key, value)
+    return record
+
+
+def test_lazy_str_defers_work():
+    calls = []
+
+    def expensive():
+        calls.append(1)
+        return 'payload'
+
+    lazy = LazyStr(expensive)
+    assert calls == []  # nothing happens until formatting
+    assert str(lazy) == 'payload'
+    assert calls == [1]
+
+
+def test_lazy_str_swallows_formatting_errors():
+    lazy = LazyStr(lambda: 1 / 0)
+    assert 'lazy log formatting failed' in str(lazy)
+
+
+def test_sampling_filter_keeps_unsampled_categories():
+    sampling = SamplingFilter({'event': 0.5})
+    assert sampling.filter(_record()) is True
+    assert sampling.filter(_record(sample_category='other')) is True
+
+
+def test_sampling_filter_applies_stride():
+    sampling = SamplingFilter({'event': 0.25})
+    kept = [
+        sampling.filter(_record(sample_category='event')) for _ in range(8)
+    ]
+    assert kept == [True, False, False, False, True, False, False, False]
+
+
+def test_sampling_filter_from_env(monkeypatch):
+    monkeypatch.setenv('LOG_SAMPLING_RATES', 'event:0.1, llm:0.5, bad, broken:x')
+    sampling = SamplingFilter.from_env()
+    assert sampling._rates == {'event': 0.1, 'llm': 0.5}
+
+
+def test_lazy_str_not_built_for_sampled_out_records():
+    """The expensive callable must not run for records the sampler drops."""
+    sampled_logger = logging.getLogger('test_lazy_sampled')
+    sampled_logger.propagate = False
+    sampled_logger.setLevel(logging.DEBUG)
+    sampled_logger.addFilter(SamplingFilter({'llm': 0.5}))
+    emitted = []
+
+    class CollectHandler(logging.Handler):
+        def emit(self, record):
+            emitted.append(record.getMessage())
+
+    handler = CollectHandler(level=logging.DEBUG)
+    sampled_logger.addHandler(handler)
+    calls = []
+
+    def expensive(index):
+        def build():
+            calls.append(index)
+            return f'payload {index}'
+
+        return build
+
+    try:
+        for i in range(4):
+            sampled_logger.debug(
+                '%s', LazyStr(expensive(i)), extra={'sample_category': 'llm'}
+            )
+    finally:
+        sampled_logger.removeHandler(handler)
+    # Stride 2: records 0 and 2 kept, 1 and 3 dropped before formatting
+    assert emitted == ['payload 0', 'payload 2']
+    assert calls == [0, 2]
@@ -0,0 +1,102 @@
+from unittest.mock import patch
+
+import pytest
+from pytest import TempPathFactory
+
+from openhands.events import EventSource, EventStream
+from openhands.events.action import NullAction
+from openhands.events.event_filter import EventFilter
+from openhands.events.event_index import EventIndex
+from openhands.events.event_store import EventStore
+from openhands.events.observation import NullObservation
+from openhands.events.serialization.event import event_from_dict
+from openhands.storage import get_file_store
+
+
+@pytest.fixture
+def temp_dir(tmp_path_factory: TempPathFactory) -> str:
+    return str(tmp_path_factory.mktemp('test_event_index'))
+
+
+def _populate(event_stream: EventStream, pairs: int = 3) -> None:
+    for _ in range(pairs):
+        event_stream.add_event(NullAction(), EventSource.AGENT)
+        event_stream.add_event(NullObservation(''), EventSource.ENVIRONMENT)
+
+
+def test_index_built_lazily_and_persisted(temp_dir: str):
+    file_store = get_file_store('local', temp_dir)
+    event_stream = EventStream('abc', file_store)
+    _populate(event_stream)
+
+    index = event_stream.get_event_index()
+    assert index.max_id == 5
+    assert index.by_type['NullAction'] == [0, 2, 4]
+    assert index.by_type['NullObservation'] == [1, 3, 5]
+    assert index.by_source['agent'] == [0, 2, 4]
+    event_stream.close()
+
+    # A fresh store loads the persisted index without rescanning
+    event_store = EventStore('abc', file_store, None)
+    reloaded = event_store.get_event_index()
+    assert reloaded.by_type['NullAction'] == [0, 2, 4]
+
+
+def test_index_kept_fresh_after_materialization(temp_dir: str):
+    file_store = get_file_store('local', temp_dir)
+    event_stream = EventStream('abc', file_store)
+    _populate(event_stream)
+    event_stream.get_event_index()
+
+    # New events are ingested inline by add_event
+    event_stream.add_event(NullAction(), EventSource.AGENT)
+    assert event_stream.get_event_index().by_type['NullAction'] == [0, 2, 4, 6]
+    event_stream.close()
+
+
+def test_filtered_search_touches_only_matching_events(temp_dir: str):
+    file_store = get_file_store('local', temp_dir)
+    event_stream = EventStream('abc', file_store)
+    _populate(event_stream, pairs=5)
+    event_stream.get_event_index()  # materialize so search can use it
+
+    with patch(
+        'openhands.events.event_store.event_from_dict',
+        side_effect=event_from_dict,
+    ) as from_dict:
+        events = list(
+            event_stream.search_events(filter=EventFilter(include_types=(NullObservation,)))
+        )
+    assert [event.id for event in events] == [1, 3, 5, 7, 9]
+    # Only the matching ids were read and materialized
+    assert from_dict.call_count == 5
+    event_stream.close()
+
+
+def test_latest_n_of_type_via_reverse_search(temp_dir: str):
+    file_store = get_file_store('local', temp_dir)
+    event_stream = EventStream('abc', file_store)
+    _populate(event_stream, pairs=5)
+    event_stream.get_event_index()
+
+    events = list(
+        event_stream.search_events(
+            reverse=True,
+            filter=EventFilter(include_types=(NullObservation,)),
+            limit=2,
+        )
+    )
+    assert [event.id for event in events] == [9, 7]
+    event_stream.close()
+
+
+def test_candidate_ids_intersects_type_and_source():
+    index = EventIndex('abc', None, None)
+    index.ingest(0, {'action': 'null', 'source': 'agent'})
+    index.ingest(1, {'observation': 'null', 'source': 'environment'})
+    index.ingest(2, {'action': 'null', 'source': 'user'})
+    assert index.candidate_ids(
+        EventFilter(include_types=(NullAction,), source='user')
+    ) == [2]
+    # A filter with no indexable criteria cannot be narrowed
+    assert index.candidate_ids(EventFilter(query='foo')) is None
@@ -863,3 +863,53 @@ def test_nested_dict_secret_replacement(temp_dir: str):
     assert 'password123' not in data_with_secrets_replaced['args']['command']
     assert 'password123' not in data_with_secrets_replaced['args']['env']['SECRET_KEY']
     assert 'password123' not in data_with_secrets_replaced['args']['env']['timestamp']
+
+
+def test_write_behind_flush_durability(temp_dir: str):
+    file_store = get_file_store('local', temp_dir)
+    event_stream = EventStream('abc', file_store, write_behind=True)
+    for _ in range(5):
+        event_stream.add_event(NullObservation(''), EventSource.AGENT)
+    # add_event returns before the write - flush() is the durability point
+    event_stream.flush()
+    for i in range(5):
+        content = event_stream.file_store.read(get_conversation_event_filename('abc', i))
+        assert content is not None
+    assert len(collect_events(event_stream)) == 5
+
+
+def test_write_behind_events_readable_before_flush(temp_dir: str):
+    file_store = get_file_store('local', temp_dir)
+    event_stream = EventStream('abc', file_store, write_behind=True)
+    event_stream.add_event(NullObservation('pending'), EventSource.AGENT)
+    # Even if the flusher has not run yet, the event must be readable
+    assert event_stream.get_event(0).content == 'pending'
+    event_stream.close()
+
+
+def test_write_behind_close_flushes(temp_dir: str):
+    file_store = get_file_store('local', temp_dir)
+    event_stream = EventStream('abc', file_store, write_behind=True)
+    for _ in range(3):
+        event_stream.add_event(NullObservation(''), EventSource.AGENT)
+    event_stream.close()
+    # Reopening the conversation must see every event
+    reopened = EventStream('abc', file_store)
+    assert len(collect_events(reopened)) == 3
+    reopened.close()
+
+
+def test_write_behind_enabled_via_env(temp_dir: str, monkeypatch):
+    """Write-behind is selectable for real construction sites through
+    OPENHANDS_EVENT_STREAM_WRITE_BEHIND."""
+    monkeypatch.setenv('OPENHANDS_EVENT_STREAM_WRITE_BEHIND', 'true')
+    monkeypatch.setenv('OPENHANDS_EVENT_STREAM_FLUSH_INTERVAL', '0.05')
+    file_store = get_file_store('local', temp_dir)
+    event_stream = EventStream('abc', file_store)
+    assert event_stream.write_behind is True
+    assert event_stream.flush_interval == 0.05
+    event_stream.add_event(NullObservation(''), EventSource.AGENT)
+    event_stream.flush()
+    content = event_stream.file_store.read(get_conversation_event_filename('abc', 0))
+    assert content is not None
+    event_stream.close()
@@ -0,0 +1,78 @@
+from unittest.mock import patch
+
+import pytest
+from pytest import TempPathFactory
+
+from openhands.events import EventSource, EventStream
+from openhands.events.action import MessageAction, NullAction
+from openhands.events.event_filter import EventFilter
+from openhands.events.observation import NullObservation
+from openhands.events.serialization.event import (
+    event_from_dict,
+    event_to_dict,
+    resolve_event_type,
+)
+from openhands.storage import get_file_store
+
+
+@pytest.fixture
+def temp_dir(tmp_path_factory: TempPathFactory) -> str:
+    return str(tmp_path_factory.mktemp('test_binary_serialization'))
+
+
+def _serialized_message_action() -> dict:
+    action = MessageAction(content='hello')
+    action._source = EventSource.USER
+    action._id = 3
+    action._timestamp = '2025-01-01T00:00:00'
+    return event_to_dict(action)
+
+
+def test_resolve_event_type():
+    assert resolve_event_type(_serialized_message_action()) is MessageAction
+    assert resolve_event_type({'observation': 'null'}) is NullObservation
+    assert resolve_event_type({'status': 'unknown'}) is None
+
+
+def test_include_data_matches_include():
+    data = _serialized_message_action()
+    event = event_from_dict(data)
+
+    type_filter = EventFilter(include_types=(NullObservation,))
+    assert type_filter.include_data(data) is False
+    assert type_filter.include(event) is False
+
+    source_filter = EventFilter(source='agent')
+    assert source_filter.include_data(data) is False
+    assert source_filter.include(event) is False
+
+    passing_filter = EventFilter(include_types=(MessageAction,), source='user')
+    assert passing_filter.include_data(data) is True
+    assert passing_filter.include(event) is True
+
+    # A content query cannot be decided from the metadata alone
+    query_filter = EventFilter(query='hello')
+    assert query_filter.include_data(data) is None
+
+
+def test_search_events_skips_materializing_filtered_payloads(temp_dir: str):
+    file_store = get_file_store('local', temp_dir)
+    event_stream = EventStream('abc', file_store)
+    for _ in range(3):
+        event_stream.add_event(NullAction(), EventSource.AGENT)
+        event_stream.add_event(NullObservation(''), EventSource.AGENT)
+
+    with patch(
+        'openhands.events.event_store.event_from_dict',
+        side_effect=event_from_dict,
+    ) as from_dict:
+        events = list(
+            event_stream.search_events(
+                filter=EventFilter(include_types=(NullObservation,))
+            )
+        )
+    assert len(events) == 3
+    # Only the three observations were materialized; the actions were
+    # rejected from their serialized metadata
+    assert from_dict.call_count == 3
+    event_stream.close()
@@ -0,0 +1,88 @@
+import time
+from unittest.mock import MagicMock
+
+from openhands.llm.router.adaptive.impl import AdaptiveRouter, EndpointStats
+
+
+def _stats(latencies=(), cooldown_until=0.0) -> EndpointStats:
+    stats = EndpointStats()
+    for latency in latencies:
+        stats.latencies.append(latency)
+    stats.cooldown_until = cooldown_until
+    return stats
+
+
+def _make_router(stats: dict, last: str = 'primary') -> AdaptiveRouter:
+    router = AdaptiveRouter.__new__(AdaptiveRouter)
+    router._stats = stats
+    router._last_routing_decision = last
+    router.available_llms = {
+        key: MagicMock(metrics=MagicMock(response_latencies=[], costs=[]))
+        for key in stats
+    }
+    return router
+
+
+def test_percentiles_and_cost():
+    stats = _stats(latencies=[1.0, 2.0, 3.0, 4.0, 10.0])
+    assert stats.p50 == 3.0
+    assert stats.p95 == 10.0
+    stats.costs.extend([0.01, 0.03])
+    assert stats.avg_cost == 0.02
+
+
+def test_hysteresis_keeps_current_endpoint():
+    # The challenger is slightly faster but not past the hysteresis margin
+    router = _make_router(
+        {'primary': _stats([1.0]), 'backup': _stats([0.9])}, last='primary'
+    )
+    assert router._select_llm([]) == 'primary'
+
+
+def test_clearly_better_endpoint_wins():
+    router = _make_router(
+        {'primary': _stats([2.0]), 'backup': _stats([0.5])}, last='primary'
+    )
+    assert router._select_llm([]) == 'backup'
+
+
+def test_unhealthy_endpoint_fails_over():
+    cooling = time.time() + 60
+    router = _make_router(
+        {'primary': _stats([0.5], cooldown_until=cooling), 'backup': _stats([2.0])},
+        last='primary',
+    )
+    assert router._select_llm([]) == 'backup'
+
+
+def test_all_unhealthy_picks_earliest_recovery():
+    now = time.time()
+    router = _make_router(
+        {
+            'primary': _stats([0.5], cooldown_until=now + 120),
+            'backup': _stats([2.0], cooldown_until=now + 30),
+        },
+        last='primary',
+    )
+    assert router._select_llm([]) == 'backup'
+
+
+def test_failure_backoff_and_recovery():
+    router = _make_router({'primary': _stats(), 'backup': _stats()})
+    router._record_failure('primary')
+    first_cooldown = router._stats['primary'].cooldown_until
+    assert first_cooldown > time.time()
+    router._record_failure('primary')
+    assert router._stats['primary'].cooldown_until > first_cooldown
+    router._record_success('primary')
+    assert router._stats['primary'].cooldown_until == 0.0
+    assert router._stats['primary'].consecutive_failures == 0
+
+
+def test_unknown_endpoint_gets_explored():
+    # An endpoint with no samples scores optimistically and gets traffic
+    # when the current endpoint has real (worse) numbers
+    router = _make_router(
+        {'primary': _stats([3.0]), 'fresh': _stats()}, last='primary'
+    )
+    assert router._select_llm([]) == 'fresh'
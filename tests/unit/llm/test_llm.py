@@ -814,9 +814,10 @@ def test_get_token_count_with_message_objects(
     token_count_obj = llm.get_token_count([message_obj])
     token_count_dict = llm.get_token_count([message_dict])
 
-    # Verify both formats get the same token count
+    # Verify both formats get the same token count. The second call hits the
+    # per-message cache because the serialized message is identical.
     assert token_count_obj == token_count_dict
-    assert mock_token_counter.call_count == 2
+    assert mock_token_counter.call_count == 1
 
 
 @patch('openhands.llm.llm.litellm.token_counter')
@@ -859,6 +860,35 @@ def test_get_token_count_error_handling(
     )
 
 
+@patch('openhands.llm.llm.litellm.token_counter')
+def test_get_token_count_caches_per_message(mock_token_counter, default_config):
+    mock_token_counter.side_effect = [10, 20, 30]
+    llm = LLM(default_config, service_id='test-service')
+    first = {'role': 'user', 'content': 'Hello!'}
+    second = {'role': 'assistant', 'content': 'Hi there'}
+
+    assert llm.get_token_count([first]) == 10
+    # Only the new message should be tokenized on the second call
+    assert llm.get_token_count([first, second]) == 30
+    assert mock_token_counter.call_count == 2
+    mock_token_counter.assert_called_with(
+        model=default_config.model, messages=[second], custom_tokenizer=None
+    )
+
+
+@patch('openhands.llm.llm.litellm.token_counter')
+def test_invalidate_token_count_cache(mock_token_counter, default_config):
+    mock_token_counter.side_effect = [10, 15]
+    llm = LLM(default_config, service_id='test-service')
+    messages = [{'role': 'user', 'content': 'Hello!'}]
+
+    assert llm.get_token_count(messages) == 10
+    llm.invalidate_token_count_cache()
+    # After invalidation the message must be tokenized again
+    assert llm.get_token_count(messages) == 15
+    assert mock_token_counter.call_count == 2
+
+
 @patch('openhands.llm.llm.litellm_completion')
 def test_llm_token_usage(mock_litellm_completion, default_config):
     # This mock response includes usage details with prompt_tokens,
@@ -1132,3 +1132,43 @@ def test_convert_fncall_messages_with_image_url():
         next(c for c in converted_messages[0]['content'] if c['type'] == 'text')['text']
         == f'EXECUTION RESULT of [{messages[0]["name"]}]:\n{messages[0]["content"][0]["text"]}'
     )
+
+
+def test_convert_fncall_messages_cache_is_transparent():
+    """Repeated conversion of the same history must hit the per-message cache
+    and produce identical output without mutating the input."""
+    from openhands.llm.fn_call_converter import _CONVERSION_CACHE
+
+    _CONVERSION_CACHE.clear()
+    original = copy.deepcopy(FNCALL_MESSAGES)
+    first = convert_fncall_messages_to_non_fncall_messages(
+        FNCALL_MESSAGES, FNCALL_TOOLS
+    )
+    assert len(_CONVERSION_CACHE) > 0
+    second = convert_fncall_messages_to_non_fncall_messages(
+        FNCALL_MESSAGES, FNCALL_TOOLS
+    )
+    assert first == second == NON_FNCALL_MESSAGES
+    # Inputs are never mutated, with or without cache hits
+    assert FNCALL_MESSAGES == original
+    # Cached results are copies - mutating one output must not leak
+    second[0]['content'] = 'mutated'
+    third = convert_fncall_messages_to_non_fncall_messages(
+        FNCALL_MESSAGES, FNCALL_TOOLS
+    )
+    assert third == NON_FNCALL_MESSAGES
+
+
+def test_convert_fncall_messages_cache_distinguishes_tools():
+    from openhands.llm.fn_call_converter import _CONVERSION_CACHE
+
+    _CONVERSION_CACHE.clear()
+    with_all_tools = convert_fncall_messages_to_non_fncall_messages(
+        FNCALL_MESSAGES, FNCALL_TOOLS
+    )
+    with_one_tool = convert_fncall_messages_to_non_fncall_messages(
+        FNCALL_MESSAGES, FNCALL_TOOLS[:1]
+    )
+    # The system prompt suffix depends on the tool set, so the cached
+    # conversions must not be shared between different tool sets
+    assert with_all_tools[0] != with_one_tool[0]
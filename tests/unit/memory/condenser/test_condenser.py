@@ -20,6 +20,7 @@ from openhands.core.config.llm_config import LLMConfig
 from openhands.core.config.openhands_config import OpenHandsConfig
 from openhands.core.message import Message, TextContent
 from openhands.core.schema.action import ActionType
+from openhands.events.action.agent import CondensationAction
 from openhands.events.event import Event, EventSource
 from openhands.events.observation import BrowserOutputObservation
 from openhands.events.observation.agent import AgentCondensationObservation
@@ -846,3 +847,120 @@ def test_condenser_pipeline_chains_sub_condensers():
 
         for event in browser_outputs[-ATTENTION_WINDOW:]:
             assert 'Content omitted' not in str(event)
+
+
+class SpeculatingCondenser(RollingCondenser):
+    """Minimal rolling condenser for exercising the pipelined mode."""
+
+    def __init__(self, max_size: int = 4):
+        self.max_size = max_size
+        self.enable_pipelining = True
+        self.condensation_count = 0
+        super().__init__()
+
+    def should_condense(self, view: View) -> bool:
+        return len(view) > self.max_size
+
+    def get_condensation(self, view: View) -> Condensation:
+        self.condensation_count += 1
+        return Condensation(
+            action=CondensationAction(
+                forgotten_event_ids=[event.id for event in view[1:-1]]
+            )
+        )
+
+
+def test_pipelining_starts_speculation_at_watermark():
+    """Crossing the watermark should kick off a background condensation."""
+    condenser = SpeculatingCondenser(max_size=4)
+    events = [create_test_event(f'Event {i}', id=i) for i in range(4)]
+
+    result = condenser.condense(View(events=events))
+    assert isinstance(result, View)
+    assert condenser._speculative_future is not None
+    condenser._speculative_future.result(timeout=5)
+    assert condenser.condensation_count == 1
+
+
+def test_pipelining_reuses_speculative_result():
+    """The speculative result should be consumed instead of recondensing."""
+    condenser = SpeculatingCondenser(max_size=4)
+    events = [create_test_event(f'Event {i}', id=i) for i in range(4)]
+    condenser.condense(View(events=events))
+    condenser._speculative_future.result(timeout=5)
+
+    events.append(create_test_event('Event 4', id=4))
+    result = condenser.condense(View(events=events))
+    assert isinstance(result, Condensation)
+    # Only the speculative run should have executed get_condensation
+    assert condenser.condensation_count == 1
+    assert result.action.forgotten == [1, 2]
+
+
+def test_pipelining_discards_stale_speculation():
+    """A speculation forgetting events no longer in the view must be dropped."""
+    condenser = SpeculatingCondenser(max_size=4)
+    events = [create_test_event(f'Event {i}', id=i) for i in range(4)]
+    condenser.condense(View(events=events))
+    condenser._speculative_future.result(timeout=5)
+
+    # History diverged: the events the speculation would forget are gone
+    new_events = [create_test_event(f'Event {i}', id=i) for i in (0, 10, 11, 12, 13)]
+    result = condenser.condense(View(events=new_events))
+    assert isinstance(result, Condensation)
+    # The stale result was discarded and a fresh condensation computed
+    assert condenser.condensation_count == 2
+    assert result.action.forgotten == [10, 11, 12]
+
+
+def test_pipelining_falls_back_when_speculation_fails():
+    """A failed speculation must fall back to synchronous condensation."""
+    condenser = SpeculatingCondenser(max_size=4)
+    events = [create_test_event(f'Event {i}', id=i) for i in range(4)]
+
+    original_get_condensation = condenser.get_condensation
+    call_count = 0
+
+    def flaky_get_condensation(view):
+        nonlocal call_count
+        call_count += 1
+        if call_count == 1:
+            raise RuntimeError('LLM unavailable')
+        return original_get_condensation(view)
+
+    condenser.get_condensation = flaky_get_condensation
+    condenser.condense(View(events=events))
+    with pytest.raises(RuntimeError):
+        condenser._speculative_future.result(timeout=5)
+
+    events.append(create_test_event('Event 4', id=4))
+    result = condenser.condense(View(events=events))
+    assert isinstance(result, Condensation)
+    assert call_count == 2
+
+
+def test_pipelining_disabled_never_speculates():
+    """With pipelining off, no background work should be scheduled."""
+    condenser = SpeculatingCondenser(max_size=4)
+    condenser.enable_pipelining = False
+    events = [create_test_event(f'Event {i}', id=i) for i in range(4)]
+
+    result = condenser.condense(View(events=events))
+    assert isinstance(result, View)
+    assert condenser._speculative_future is None
+    assert condenser.condensation_count == 0
+
+
+def test_pipelining_keeps_completed_speculation_until_needed():
+    """Steps between the watermark and the threshold must not respeculate."""
+    condenser = SpeculatingCondenser(max_size=10)
+    events = [create_test_event(f'Event {i}', id=i) for i in range(8)]
+    condenser.condense(View(events=events))
+    condenser._speculative_future.result(timeout=5)
+
+    # More steps above the watermark but below the threshold
+    for i in (8, 9):
+        events.append(create_test_event(f'Event {i}', id=i))
+        result = condenser.condense(View(events=events))
+        assert isinstance(result, View)
+    assert condenser.condensation_count == 1
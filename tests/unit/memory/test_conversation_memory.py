@@ -1,6 +1,6 @@
 import os
 import shutil
-from unittest.mock import MagicMock, Mock
+from unittest.mock import MagicMock, Mock, patch
 
 import pytest
 from litellm import ChatCompletionMessageToolCall
@@ -1583,3 +1583,162 @@ def test_process_ipython_observation_with_vision_disabled(
     assert isinstance(message.content[1], ImageContent)
     # Check that NO explanatory text about filtered images was added when vision is disabled
     assert 'invalid or empty image(s) were filtered' not in message.content[0].text
+
+
+def _make_identified_history():
+    """Build a small history where every event carries a stream id."""
+    system_message = SystemMessageAction(content='System message')
+    system_message._source = EventSource.AGENT
+    system_message._id = 0
+    user_message = MessageAction(content='Hello')
+    user_message._source = EventSource.USER
+    user_message._id = 1
+    assistant_message = MessageAction(content='Hi there')
+    assistant_message._source = EventSource.AGENT
+    assistant_message._id = 2
+    return [system_message, user_message, assistant_message]
+
+
+def test_incremental_processing_converts_only_new_events(conversation_memory):
+    """A history extending the previous one should only convert the delta."""
+    history = _make_identified_history()
+    initial_user_action = history[1]
+    first = conversation_memory.process_events(
+        condensed_history=list(history),
+        initial_user_action=initial_user_action,
+        max_message_chars=None,
+        vision_is_active=False,
+    )
+    assert len(first) == 3
+
+    new_message = MessageAction(content='Follow-up question')
+    new_message._source = EventSource.USER
+    new_message._id = 3
+    history.append(new_message)
+
+    original_process_action = conversation_memory._process_action
+    with patch.object(
+        conversation_memory,
+        '_process_action',
+        side_effect=original_process_action,
+    ) as process_action:
+        second = conversation_memory.process_events(
+            condensed_history=list(history),
+            initial_user_action=initial_user_action,
+            max_message_chars=None,
+            vision_is_active=False,
+        )
+    # Only the new event should have been converted
+    assert process_action.call_count == 1
+    assert len(second) == 4
+    assert second[3].content[0].text == 'Follow-up question'
+
+
+def test_incremental_cache_matches_full_conversion(agent_config):
+    """Incremental output must be identical to a from-scratch conversion."""
+    prompt_manager = MagicMock(spec=PromptManager)
+    prompt_manager.get_system_message.return_value = 'System message'
+    incremental_memory = ConversationMemory(agent_config, prompt_manager)
+    fresh_memory = ConversationMemory(agent_config, prompt_manager)
+
+    history = _make_identified_history()
+    initial_user_action = history[1]
+    incremental_memory.process_events(
+        condensed_history=list(history),
+        initial_user_action=initial_user_action,
+        max_message_chars=None,
+        vision_is_active=False,
+    )
+    new_message = MessageAction(content='Another message')
+    new_message._source = EventSource.USER
+    new_message._id = 3
+    history.append(new_message)
+
+    incremental = incremental_memory.process_events(
+        condensed_history=list(history),
+        initial_user_action=initial_user_action,
+        max_message_chars=None,
+        vision_is_active=False,
+    )
+    full = fresh_memory.process_events(
+        condensed_history=list(history),
+        initial_user_action=initial_user_action,
+        max_message_chars=None,
+        vision_is_active=False,
+    )
+    assert [m.model_dump() for m in incremental] == [m.model_dump() for m in full]
+
+
+def test_incremental_cache_invalidated_when_prefix_changes(conversation_memory):
+    """A condensation rewrites the prefix, which must drop the cache."""
+    history = _make_identified_history()
+    initial_user_action = history[1]
+    conversation_memory.process_events(
+        condensed_history=list(history),
+        initial_user_action=initial_user_action,
+        max_message_chars=None,
+        vision_is_active=False,
+    )
+
+    # Replace the assistant message, as a condensation would
+    replacement = MessageAction(content='Condensed summary')
+    replacement._source = EventSource.AGENT
+    replacement._id = 4
+    condensed = [history[0], history[1], replacement]
+
+    messages = conversation_memory.process_events(
+        condensed_history=condensed,
+        initial_user_action=initial_user_action,
+        max_message_chars=None,
+        vision_is_active=False,
+    )
+    assert len(messages) == 3
+    assert messages[2].content[0].text == 'Condensed summary'
+
+
+def test_consecutive_user_messages_not_reformatted_across_steps(conversation_memory):
+    """The newline separator must not accumulate when messages are cached."""
+    history = _make_identified_history()
+    initial_user_action = history[1]
+    second_user_message = MessageAction(content='Second user message')
+    second_user_message._source = EventSource.USER
+    second_user_message._id = 3
+    history.append(second_user_message)
+
+    for _ in range(3):
+        messages = conversation_memory.process_events(
+            condensed_history=list(history),
+            initial_user_action=initial_user_action,
+            max_message_chars=None,
+            vision_is_active=False,
+        )
+    assert messages[3].content[0].text == '\n\nSecond user message'
+
+
+def test_incremental_cache_invalidated_when_conversion_params_change(
+    conversation_memory,
+):
+    """Changing truncation or vision settings must drop the cached prefix."""
+    history = _make_identified_history()
+    initial_user_action = history[1]
+    conversation_memory.process_events(
+        condensed_history=list(history),
+        initial_user_action=initial_user_action,
+        max_message_chars=None,
+        vision_is_active=False,
+    )
+
+    original_process_action = conversation_memory._process_action
+    with patch.object(
+        conversation_memory,
+        '_process_action',
+        side_effect=original_process_action,
+    ) as process_action:
+        conversation_memory.process_events(
+            condensed_history=list(history),
+            initial_user_action=initial_user_action,
+            max_message_chars=5000,  # different truncation limit
+            vision_is_active=False,
+        )
+    # The whole history was reconverted, not served from the cache
+    assert process_action.call_count == len(history)
@@ -0,0 +1,86 @@
+"""Tests for the precompiled microagent trigger index."""
+
+from openhands.microagent import (
+    BaseMicroagent,
+    KnowledgeMicroagent,
+    TriggerIndex,
+)
+from openhands.microagent.microagent import _PARSED_MICROAGENT_CACHE
+from openhands.microagent.types import MicroagentMetadata, MicroagentType
+
+
+def _make_agent(name: str, triggers: list[str]) -> KnowledgeMicroagent:
+    return KnowledgeMicroagent(
+        name=name,
+        content=f'{name} content',
+        metadata=MicroagentMetadata(name=name, triggers=triggers),
+        source=f'{name}.md',
+        type=MicroagentType.KNOWLEDGE,
+    )
+
+
+def test_match_agrees_with_match_trigger():
+    agents = [
+        _make_agent('python', ['python', 'pip']),
+        _make_agent('docker', ['docker', 'container']),
+        _make_agent('git', ['git']),
+    ]
+    index = TriggerIndex.for_microagents(agents)
+    queries = [
+        'how do I install a pip package',
+        'run it in a Docker container',
+        'no match here',
+        'git inside docker with python',
+    ]
+    for query in queries:
+        expected = [
+            (agent.name, trigger)
+            for agent in agents
+            if (trigger := agent.match_trigger(query)) is not None
+        ]
+        assert index.match(query) == expected
+
+
+def test_first_trigger_in_declaration_order_wins():
+    agent = _make_agent('ordered', ['beta', 'alpha'])
+    index = TriggerIndex.for_microagents([agent])
+    # Both triggers occur; the first in declaration order is returned
+    assert index.match('alpha then beta') == [('ordered', 'beta')]
+
+
+def test_match_is_case_insensitive():
+    index = TriggerIndex.for_microagents([_make_agent('k8s', ['Kubernetes'])])
+    assert index.match('deploy to KUBERNETES now') == [('k8s', 'Kubernetes')]
+
+
+def test_index_reused_for_same_trigger_set():
+    agents = [_make_agent('python', ['python'])]
+    first = TriggerIndex.for_microagents(agents)
+    second = TriggerIndex.for_microagents([_make_agent('python', ['python'])])
+    assert first is second
+
+
+def test_load_cache_reuses_parsed_microagent(tmp_path):
+    content = """---
+name: cached_agent
+triggers:
+- caching
+---
+
+# Cached Agent
+
+Some content.
+"""
+    agent_file = tmp_path / 'cached_agent.md'
+    agent_file.write_text(content)
+
+    _PARSED_MICROAGENT_CACHE.clear()
+    first = BaseMicroagent.load(agent_file, tmp_path)
+    second = BaseMicroagent.load(agent_file, tmp_path)
+    assert first is second
+
+    # A content change must produce a freshly parsed agent
+    agent_file.write_text(content.replace('Some content.', 'New content.'))
+    third = BaseMicroagent.load(agent_file, tmp_path)
+    assert third is not first
+    assert 'New content.' in third.content
@@ -139,7 +139,10 @@ def test_get_hash_for_lock_files_different_enable_browser():
 def test_get_hash_for_source_files():
     dirhash_mock = MagicMock()
     dirhash_mock.return_value = '1f69bd20d68d9e3874d5bf7f7459709b'
-    with patch(f'{get_hash_for_source_files.__module__}.dirhash', dirhash_mock):
+    with (
+        patch(f'{get_hash_for_source_files.__module__}._source_hash_cache', None),
+        patch(f'{get_hash_for_source_files.__module__}.dirhash', dirhash_mock),
+    ):
         result = get_hash_for_source_files()
         assert result == truncate_hash(dirhash_mock.return_value)
         dirhash_mock.assert_called_once_with(
@@ -683,3 +686,29 @@ def test_truncate_hash():
     assert truncated == 'pma2wc71uq3c9a85'
     truncated = truncate_hash('102aecc0cea025253c0278f54ebef078')
     assert truncated == '4titk6gquia3taj5'
+
+
+def test_get_hash_for_source_files_is_memoized():
+    dirhash_mock = MagicMock()
+    dirhash_mock.return_value = '1f69bd20d68d9e3874d5bf7f7459709b'
+    with (
+        patch(f'{get_hash_for_source_files.__module__}._source_hash_cache', None),
+        patch(f'{get_hash_for_source_files.__module__}.dirhash', dirhash_mock),
+    ):
+        first = get_hash_for_source_files()
+        # The source tree did not change, so the expensive dirhash walk
+        # must not run again
+        second = get_hash_for_source_files()
+    assert first == second
+    dirhash_mock.assert_called_once()
+
+
+def test_build_stage_records_timings():
+    import time as time_module
+
+    from openhands.runtime.utils.runtime_build import LAST_BUILD_TIMINGS, _build_stage
+
+    LAST_BUILD_TIMINGS.clear()
+    with _build_stage('stage_x'):
+        time_module.sleep(0.01)
+    assert LAST_BUILD_TIMINGS['stage_x'] >= 0.01
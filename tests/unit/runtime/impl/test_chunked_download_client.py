@@ -0,0 +1,148 @@
+"""Tests for the chunked download path in ActionExecutionClient.copy_from."""
+
+from contextlib import contextmanager
+from types import SimpleNamespace
+
+import httpx
+import pytest
+
+from openhands.core.exceptions import AgentRuntimeError
+from openhands.runtime.impl.action_execution.action_execution_client import (
+    ActionExecutionClient,
+)
+
+ARCHIVE = bytes(range(256)) * 3  # 768 bytes of recognizable data
+
+
+class _FakeResponse:
+    def __init__(self, content=b'', json_data=None, status_code=200):
+        self.content = content
+        self._json_data = json_data
+        self.status_code = status_code
+
+    def raise_for_status(self):
+        if self.status_code >= 400:
+            raise httpx.HTTPStatusError(
+                f'HTTP {self.status_code}',
+                request=SimpleNamespace(),
+                response=self,
+            )
+
+    def json(self):
+        return self._json_data
+
+    def iter_bytes(self):
+        yield self.content
+
+
+class _FakeSession:
+    """Serves /download_chunk range requests over ARCHIVE."""
+
+    def __init__(self, fail_ranges=None):
+        self.requests = []
+        self.headers = {}
+        # Range values that should fail once before succeeding
+        self._remaining_failures = dict(fail_ranges or {})
+
+    def request(self, method, url, **kwargs):
+        self.requests.append((method, url, kwargs))
+        range_header = kwargs['headers']['Range']
+        if self._remaining_failures.get(range_header, 0) > 0:
+            self._remaining_failures[range_header] -= 1
+            raise httpx.ConnectError('flaky network')
+        start, end = range_header.removeprefix('bytes=').split('-')
+        return _FakeResponse(content=ARCHIVE[int(start) : int(end) + 1])
+
+    @contextmanager
+    def stream(self, method, url, **kwargs):
+        self.requests.append((method, url, kwargs))
+        yield _FakeResponse(content=ARCHIVE)
+
+
+def _make_client(session, prepare_response=None):
+    class _TransferClient(ActionExecutionClient):
+        @property
+        def action_execution_server_url(self):
+            return 'http://server'
+
+        def log(self, *args, **kwargs):
+            pass
+
+    _TransferClient.__abstractmethods__ = frozenset()
+    client = _TransferClient.__new__(_TransferClient)
+    client.session = session
+    client.DOWNLOAD_CHUNK_SIZE = 256
+    client.DOWNLOAD_MAX_WORKERS = 2
+
+    server_calls = []
+
+    def send_request(method, url, **kwargs):
+        server_calls.append((method, url, kwargs))
+        if url.endswith('/download_prepare'):
+            if isinstance(prepare_response, Exception):
+                raise prepare_response
+            return _FakeResponse(
+                json_data=prepare_response
+                or {'transfer_id': 'transfer-1', 'size': len(ARCHIVE)}
+            )
+        return _FakeResponse(json_data={'removed': True})
+
+    client._send_action_server_request = send_request
+    client._server_calls = server_calls
+    return client
+
+
+def test_chunked_download_reassembles_archive(tmp_path):
+    session = _FakeSession()
+    client = _make_client(session)
+
+    result = client.copy_from('/workspace/project')
+
+    assert result.read_bytes() == ARCHIVE
+    # 768 bytes at 256 per chunk = 3 ranged requests
+    chunk_requests = [r for r in session.requests if 'download_chunk' in r[1]]
+    assert len(chunk_requests) == 3
+    # The transfer was released afterwards
+    assert any('download_complete' in url for _, url, _ in client._server_calls)
+    result.unlink()
+
+
+def test_failed_chunk_is_retried(tmp_path):
+    session = _FakeSession(fail_ranges={'bytes=256-511': 1})
+    client = _make_client(session)
+
+    result = client.copy_from('/workspace/project')
+
+    assert result.read_bytes() == ARCHIVE
+    chunk_requests = [r for r in session.requests if 'download_chunk' in r[1]]
+    # One extra request for the retried range
+    assert len(chunk_requests) == 4
+    result.unlink()
+
+
+def test_persistent_chunk_failure_raises(tmp_path):
+    session = _FakeSession(fail_ranges={'bytes=256-511': 99})
+    client = _make_client(session)
+
+    with pytest.raises(AgentRuntimeError):
+        client.copy_from('/workspace/project')
+    # The transfer is still released on failure
+    assert any('download_complete' in url for _, url, _ in client._server_calls)
+
+
+def test_fallback_to_legacy_stream_on_older_server(tmp_path):
+    session = _FakeSession()
+    missing = httpx.HTTPStatusError(
+        'HTTP 404',
+        request=SimpleNamespace(),
+        response=SimpleNamespace(status_code=404),
+    )
+    client = _make_client(session, prepare_response=missing)
+
+    result = client.copy_from('/workspace/project')
+
+    # The legacy single-stream endpoint served the archive
+    stream_requests = [r for r in session.requests if 'download_files' in r[1]]
+    assert len(stream_requests) == 1
+    assert result.read_bytes() == ARCHIVE
+    result.unlink()
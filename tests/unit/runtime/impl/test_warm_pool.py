@@ -0,0 +1,186 @@
+import time
+from unittest.mock import MagicMock
+
+from openhands.runtime.impl.docker.warm_pool import DockerWarmPool, WarmContainer
+
+
+def _make_entry(name: str = 'warm-test') -> WarmContainer:
+    container = MagicMock()
+    container.name = name
+    return WarmContainer(
+        container=container,
+        host_port=30001,
+        vscode_port=40001,
+        app_ports=[50001, 55001],
+        host_port_lock=None,
+        vscode_port_lock=None,
+        app_port_locks=[],
+        bootstrap_secret='bootstrap-secret',
+    )
+
+
+def _wait_for(condition, timeout=5.0):
+    deadline = time.time() + timeout
+    while time.time() < deadline:
+        if condition():
+            return True
+        time.sleep(0.01)
+    return False
+
+
+def test_claim_miss_triggers_replenish():
+    pool = DockerWarmPool('key-miss', size=2, idle_timeout=600)
+    spawned = []
+
+    def spawn():
+        entry = _make_entry(f'warm-{len(spawned)}')
+        spawned.append(entry)
+        return entry
+
+    pool.set_spawner(spawn)
+    assert pool.claim() is None
+    assert _wait_for(lambda: pool.get_metrics()['available'] == 2)
+    metrics = pool.get_metrics()
+    assert metrics['misses'] == 1
+    assert metrics['spawned'] == 2
+
+
+def test_claim_hit_and_replenish():
+    pool = DockerWarmPool('key-hit', size=1, idle_timeout=600)
+    pool.set_spawner(lambda: _make_entry())
+    pool.claim()  # miss, kicks off replenishment
+    assert _wait_for(lambda: pool.get_metrics()['available'] == 1)
+
+    entry = pool.claim()
+    assert entry is not None
+    metrics = pool.get_metrics()
+    assert metrics['hits'] == 1
+    # The claimed entry is replaced in the background
+    assert _wait_for(lambda: pool.get_metrics()['available'] == 1)
+
+
+def test_reap_idle_discards_old_entries():
+    pool = DockerWarmPool('key-reap', size=1, idle_timeout=0.01)
+    entry = _make_entry()
+    pool._entries.append(entry)
+    time.sleep(0.05)
+    pool.reap_idle()
+    assert pool.get_metrics()['reaped'] == 1
+    assert pool.get_metrics()['available'] == 0
+    entry.container.remove.assert_called_once_with(force=True)
+
+
+def test_spawn_failure_is_counted():
+    pool = DockerWarmPool('key-fail', size=1, idle_timeout=600)
+
+    def failing_spawn():
+        raise RuntimeError('docker unavailable')
+
+    pool.set_spawner(failing_spawn)
+    assert pool.claim() is None
+    assert _wait_for(lambda: pool.get_metrics()['spawn_failures'] == 1)
+    assert pool.get_metrics()['available'] == 0
+
+
+def test_get_pool_reuses_instance():
+    pool_a = DockerWarmPool.get_pool('key-shared', size=1, idle_timeout=600)
+    pool_b = DockerWarmPool.get_pool('key-shared', size=3, idle_timeout=60)
+    assert pool_a is pool_b
+    # The most recent configuration wins
+    assert pool_a.size == 3
+    assert pool_a.idle_timeout == 60
+
+
+def _make_pool_ready_runtime():
+    """A DockerRuntime wired the way a real server configures it: prebuilt
+    image, a per-session API key, and a static workspace mount."""
+    from openhands.core.config import OpenHandsConfig
+    from openhands.runtime.impl.docker.docker_runtime import DockerRuntime
+
+    runtime = DockerRuntime.__new__(DockerRuntime)
+    config = OpenHandsConfig()
+    config.sandbox.warm_pool_size = 2
+    config.sandbox.runtime_container_image = 'ghcr.io/openhands/runtime:test'
+    config.sandbox.runtime_startup_env_vars = {'SESSION_API_KEY': 'secret-key'}
+    config.sandbox.local_runtime_url = 'http://localhost'
+    runtime.config = config
+    runtime.sid = 'conv-123'
+    runtime.container_name = 'openhands-runtime-conv-123'
+    runtime.runtime_container_image = config.sandbox.runtime_container_image
+    # Static workspace mount, identical for every conversation
+    runtime._process_volumes = lambda: {
+        '/home/user/workspace': {'bind': '/workspace', 'mode': 'rw'}
+    }
+    runtime._process_overlay_mounts = lambda: []
+    runtime.log = MagicMock()
+    runtime.set_runtime_status = MagicMock()
+    runtime.session = MagicMock()
+    runtime.session.request.return_value.raise_for_status = MagicMock()
+    return runtime
+
+
+def test_warm_pool_enabled_for_realistic_config():
+    runtime = _make_pool_ready_runtime()
+    assert runtime._warm_pool_enabled() is True
+
+
+def test_warm_pool_disabled_for_per_session_mount():
+    runtime = _make_pool_ready_runtime()
+    runtime._process_volumes = lambda: {
+        '/data/sessions/conv-123': {'bind': '/root/.openhands', 'mode': 'rw'}
+    }
+    assert runtime._warm_pool_enabled() is False
+
+
+def test_realistic_config_claims_warm_container():
+    runtime = _make_pool_ready_runtime()
+
+    entry = _make_entry('openhands-runtime-warm-abc')
+    entry.container.status = 'running'
+    pool = MagicMock()
+    pool.claim.return_value = entry
+    runtime._get_warm_pool = lambda: pool
+
+    assert runtime.try_adopt_warm_container() is True
+    entry.container.rename.assert_called_once_with('openhands-runtime-conv-123')
+    # The key rotation authenticates with the container's bootstrap secret
+    runtime.session.request.assert_called_once()
+    args, kwargs = runtime.session.request.call_args
+    assert args == ('POST', 'http://localhost:30001/set_session_api_key')
+    assert kwargs['json'] == {'session_api_key': 'secret-key'}
+    assert kwargs['headers'] == {'X-Session-API-Key': 'bootstrap-secret'}
+    assert runtime.container is entry.container
+    assert runtime._host_port == entry.host_port
+    pool.set_spawner.assert_called_once()
+
+
+def test_keyless_adoption_keeps_bootstrap_secret():
+    """Deployments without a session key keep authenticating with the
+    container's bootstrap secret instead of going unauthenticated."""
+    runtime = _make_pool_ready_runtime()
+    runtime.config.sandbox.runtime_startup_env_vars = {}
+    runtime.session.headers = {}
+    entry = _make_entry('openhands-runtime-warm-abc')
+    entry.container.status = 'running'
+    pool = MagicMock()
+    pool.claim.return_value = entry
+    runtime._get_warm_pool = lambda: pool
+
+    assert runtime.try_adopt_warm_container() is True
+    runtime.session.request.assert_not_called()
+    assert runtime.session.headers['X-Session-API-Key'] == 'bootstrap-secret'
+
+
+def test_failed_key_delivery_discards_warm_container():
+    import httpx
+
+    runtime = _make_pool_ready_runtime()
+    entry = _make_entry('openhands-runtime-warm-abc')
+    entry.container.status = 'running'
+    pool = MagicMock()
+    pool.claim.return_value = entry
+    runtime._get_warm_pool = lambda: pool
+    runtime.session.request.side_effect = httpx.ConnectError('refused')
+
+    assert runtime.try_adopt_warm_container() is False
+    entry.container.remove.assert_called_once_with(force=True)
@@ -0,0 +1,46 @@
+import numpy as np
+import pytest
+from PIL import Image
+
+from openhands.runtime.browser.base64 import (
+    image_to_base64_url,
+    image_to_png_base64_url,
+    png_base64_url_to_image,
+)
+
+
+@pytest.fixture
+def frame() -> np.ndarray:
+    rng = np.random.default_rng(seed=7)
+    return rng.integers(0, 255, size=(64, 64, 3), dtype=np.uint8)
+
+
+@pytest.mark.parametrize(
+    'image_format,mime',
+    [('png', 'image/png'), ('webp', 'image/webp'), ('jpeg', 'image/jpeg')],
+)
+def test_data_url_mime_matches_codec(frame, image_format, mime):
+    url = image_to_base64_url(frame, add_data_prefix=True, image_format=image_format)
+    assert url.startswith(f'data:{mime};base64,')
+    decoded = png_base64_url_to_image(url)
+    assert isinstance(decoded, Image.Image)
+    assert decoded.size == (64, 64)
+
+
+def test_lossy_codecs_are_smaller_than_png(frame):
+    # A screenshot-like frame with flat regions compresses far better lossily
+    flat = np.full((256, 256, 3), 240, dtype=np.uint8)
+    flat[50:60, 50:200] = 0  # some "text"
+    png = image_to_base64_url(flat, image_format='png')
+    webp = image_to_base64_url(flat, image_format='webp', quality=80)
+    assert len(webp) < len(png)
+
+
+def test_unknown_format_falls_back_to_png(frame):
+    url = image_to_base64_url(frame, add_data_prefix=True, image_format='tiff')
+    assert url.startswith('data:image/png;base64,')
+
+
+def test_png_helper_unchanged(frame):
+    url = image_to_png_base64_url(frame, add_data_prefix=True)
+    assert url.startswith('data:image/png;base64,')
@@ -386,3 +386,25 @@ def test_python_interactive_input():
     assert session.prev_status == BashCommandStatus.COMPLETED
 
     session.close()
+
+
+def test_event_driven_output_pipe_active():
+    session = BashSession(work_dir=os.getcwd())
+    session.initialize()
+    # The FIFO-backed reader should be up, so execute() waits on events
+    assert session._output_event is not None
+    obs = session.execute(CmdRunAction("echo 'event driven'"))
+    assert 'event driven' in obs.content
+    assert obs.metadata.exit_code == 0
+    session.close()
+
+
+def test_polling_fallback_when_pipe_unavailable():
+    session = BashSession(work_dir=os.getcwd())
+    session.initialize()
+    # Simulate environments where the FIFO could not be created
+    session._output_event = None
+    obs = session.execute(CmdRunAction("echo 'polling fallback'"))
+    assert 'polling fallback' in obs.content
+    assert obs.metadata.exit_code == 0
+    session.close()
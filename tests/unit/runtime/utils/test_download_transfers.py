@@ -0,0 +1,108 @@
+import zipfile
+
+import pytest
+
+from openhands.runtime.utils.download_transfers import (
+    DownloadTransfers,
+    RangeError,
+)
+
+
+@pytest.fixture
+def archive_dir(tmp_path):
+    source = tmp_path / 'source'
+    source.mkdir()
+    (source / 'a.txt').write_text('alpha' * 100)
+    (source / 'b.txt').write_text('beta' * 100)
+    return source
+
+
+def test_prepare_and_reassemble_by_ranges(archive_dir):
+    transfers = DownloadTransfers()
+    transfer = transfers.prepare(str(archive_dir))
+    size = transfer['size']
+    assert size > 0
+
+    # Fetch in 128-byte ranges and reassemble
+    reassembled = b''
+    for start in range(0, size, 128):
+        end = min(start + 128, size) - 1
+        data, got_start, got_end, got_size = transfers.read_chunk(
+            transfer['transfer_id'], f'bytes={start}-{end}'
+        )
+        assert (got_start, got_end, got_size) == (start, end, size)
+        reassembled += data
+
+    # The reassembled bytes are a valid archive with the original content
+    archive_path = archive_dir.parent / 'reassembled.zip'
+    archive_path.write_bytes(reassembled)
+    with zipfile.ZipFile(archive_path) as zipf:
+        assert sorted(zipf.namelist()) == ['a.txt', 'b.txt']
+        assert zipf.read('a.txt').decode() == 'alpha' * 100
+
+
+def test_open_ended_range(archive_dir):
+    transfers = DownloadTransfers()
+    transfer = transfers.prepare(str(archive_dir))
+    data, start, end, size = transfers.read_chunk(
+        transfer['transfer_id'], 'bytes=10-'
+    )
+    assert (start, end) == (10, size - 1)
+    assert len(data) == size - 10
+
+
+@pytest.mark.parametrize(
+    'range_header,status',
+    [
+        (None, 400),
+        ('10-20', 400),
+        ('bytes=abc-def', 400),
+        ('bytes=-5-10', 400),
+        ('bytes=20-10', 416),
+        ('bytes=0-999999999', 416),
+    ],
+)
+def test_bad_ranges_rejected(archive_dir, range_header, status):
+    transfers = DownloadTransfers()
+    transfer = transfers.prepare(str(archive_dir))
+    with pytest.raises(RangeError) as excinfo:
+        transfers.read_chunk(transfer['transfer_id'], range_header)
+    assert excinfo.value.status_code == status
+
+
+def test_oversized_range_capped(archive_dir):
+    transfers = DownloadTransfers(max_chunk_size=64)
+    transfer = transfers.prepare(str(archive_dir))
+    with pytest.raises(RangeError) as excinfo:
+        transfers.read_chunk(transfer['transfer_id'], 'bytes=0-200')
+    assert excinfo.value.status_code == 416
+
+
+def test_unknown_transfer_raises_key_error(archive_dir):
+    transfers = DownloadTransfers()
+    with pytest.raises(KeyError):
+        transfers.read_chunk('no-such-transfer', 'bytes=0-1')
+
+
+def test_complete_removes_archive(archive_dir):
+    import os
+
+    transfers = DownloadTransfers()
+    transfer = transfers.prepare(str(archive_dir))
+    zip_path = transfers._transfers[transfer['transfer_id']][0]
+    assert transfers.complete(transfer['transfer_id']) is True
+    assert not os.path.exists(zip_path)
+    assert transfers.complete(transfer['transfer_id']) is False
+
+
+def test_stale_transfers_purged(archive_dir):
+    import os
+    import time
+
+    transfers = DownloadTransfers(ttl_seconds=0.01)
+    transfer = transfers.prepare(str(archive_dir))
+    zip_path = transfers._transfers[transfer['transfer_id']][0]
+    time.sleep(0.05)
+    transfers.purge_stale()
+    assert transfer['transfer_id'] not in transfers._transfers
+    assert not os.path.exists(zip_path)
@@ -292,3 +292,88 @@ class TestGitHandler(unittest.TestCase):
                 'modified': 'unchanged.txt\nLine 1\nLine 2\nLine 3',
             }
             assert diff == expected_diff
+
+
+@pytest.mark.skipif(sys.platform == 'win32', reason='Windows is not supported')
+class TestGitChangesCache(unittest.TestCase):
+    def _make_handler(self, responses):
+        calls = []
+
+        def execute(cmd, cwd):
+            calls.append(cmd)
+            if 'rev-parse HEAD' in cmd:
+                return CommandResult(responses['state'], 0)
+            return CommandResult(responses['changes'], 0)
+
+        handler = GitHandler(execute_shell_fn=execute, create_file_fn=lambda p, c: 0)
+        handler.set_cwd('/repo')
+        return handler, calls
+
+    def test_unchanged_state_served_from_cache(self):
+        handler, calls = self._make_handler(
+            {'state': 'abc123\n1700000000-4096', 'changes': '[{"status": "M", "path": "a.txt"}]'}
+        )
+        first = handler.get_git_changes()
+        second = handler.get_git_changes()
+        assert first == second == [{'status': 'M', 'path': 'a.txt'}]
+        # One state probe per call, but the change scan ran only once
+        scan_calls = [c for c in calls if 'rev-parse HEAD' not in c]
+        assert len(scan_calls) == 1
+
+    def test_state_change_invalidates_cache(self):
+        states = iter(['abc\n1-1', 'def\n2-2'])
+        payloads = iter(
+            ['[{"status": "M", "path": "a.txt"}]', '[{"status": "A", "path": "b.txt"}]']
+        )
+        calls = []
+
+        def execute(cmd, cwd):
+            calls.append(cmd)
+            if 'rev-parse HEAD' in cmd:
+                return CommandResult(next(states), 0)
+            return CommandResult(next(payloads), 0)
+
+        handler = GitHandler(execute_shell_fn=execute, create_file_fn=lambda p, c: 0)
+        handler.set_cwd('/repo')
+        assert handler.get_git_changes() == [{'status': 'M', 'path': 'a.txt'}]
+        # HEAD/index changed - the cache must be bypassed
+        assert handler.get_git_changes() == [{'status': 'A', 'path': 'b.txt'}]
+
+
+@pytest.mark.skipif(sys.platform == 'win32', reason='Windows is not supported')
+class TestGitPerfConfig(unittest.TestCase):
+    def setUp(self):
+        self.repo_dir = tempfile.mkdtemp()
+        subprocess.run(['git', 'init'], cwd=self.repo_dir, capture_output=True)
+
+    def tearDown(self):
+        shutil.rmtree(self.repo_dir, ignore_errors=True)
+
+    def _get_config(self, key):
+        result = subprocess.run(
+            ['git', 'config', '--get', key],
+            cwd=self.repo_dir,
+            capture_output=True,
+            text=True,
+        )
+        return result.stdout.strip()
+
+    def test_fsmonitor_not_set_on_old_git(self):
+        """On git < 2.37 core.fsmonitor is a hook command: a value of 'true'
+        would silently corrupt status output, so it must not be set."""
+        with patch.object(git_changes, 'git_supports_builtin_fsmonitor') as supports:
+            supports.return_value = False
+            git_changes.ensure_perf_config(self.repo_dir)
+        assert self._get_config('core.untrackedCache') == 'true'
+        assert self._get_config('core.fsmonitor') == ''
+
+    def test_fsmonitor_set_on_supported_git(self):
+        with patch.object(git_changes, 'git_supports_builtin_fsmonitor') as supports:
+            supports.return_value = True
+            git_changes.ensure_perf_config(self.repo_dir)
+        assert self._get_config('core.fsmonitor') == 'true'
+
+    def test_version_parsing(self):
+        # The real git in the test environment reports its version
+        result = git_changes.git_supports_builtin_fsmonitor(self.repo_dir)
+        assert isinstance(result, bool)
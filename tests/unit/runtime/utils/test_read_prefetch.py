@@ -0,0 +1,80 @@
+import time
+
+from openhands.events.action import CmdRunAction
+from openhands.events.action.files import FileReadAction
+from openhands.events.observation import ErrorObservation
+from openhands.events.observation.files import FileReadObservation
+from openhands.runtime.utils.read_prefetch import ReadPrefetcher
+
+
+def _wait_for_prefetch(prefetcher: ReadPrefetcher, timeout: float = 5.0) -> None:
+    deadline = time.time() + timeout
+    while time.time() < deadline:
+        thread = prefetcher._prefetch_thread
+        if thread is not None and not thread.is_alive():
+            return
+        time.sleep(0.01)
+
+
+def test_prefetched_read_is_served_from_cache():
+    contents = {'file.txt': 'version 1'}
+    calls = []
+
+    def run_action(action):
+        calls.append(action.path)
+        return FileReadObservation(path=action.path, content=contents[action.path])
+
+    prefetcher = ReadPrefetcher(run_action)
+    read = FileReadAction(path='file.txt')
+
+    # First read misses and registers the path
+    assert prefetcher.on_action(read) is None
+    prefetcher.after_action()
+    _wait_for_prefetch(prefetcher)
+    assert calls == ['file.txt']
+
+    # The next identical read is served speculatively
+    cached = prefetcher.on_action(FileReadAction(path='file.txt'))
+    assert cached is not None
+    assert cached.content == 'version 1'
+
+
+def test_mutating_action_invalidates_cache():
+    def run_action(action):
+        return FileReadObservation(path=action.path, content='data')
+
+    prefetcher = ReadPrefetcher(run_action)
+    prefetcher.on_action(FileReadAction(path='file.txt'))
+    prefetcher.after_action()
+    _wait_for_prefetch(prefetcher)
+
+    # A command may have rewritten the file - nothing may be served
+    assert prefetcher.on_action(CmdRunAction(command='echo x > file.txt')) is None
+    assert prefetcher.on_action(FileReadAction(path='file.txt')) is None
+
+
+def test_error_observations_are_not_cached():
+    def run_action(action):
+        return ErrorObservation('File not found')
+
+    prefetcher = ReadPrefetcher(run_action)
+    prefetcher.on_action(FileReadAction(path='missing.txt'))
+    prefetcher.after_action()
+    _wait_for_prefetch(prefetcher)
+    assert prefetcher.on_action(FileReadAction(path='missing.txt')) is None
+
+
+def test_served_result_is_a_copy():
+    def run_action(action):
+        return FileReadObservation(path=action.path, content='data')
+
+    prefetcher = ReadPrefetcher(run_action)
+    prefetcher.on_action(FileReadAction(path='file.txt'))
+    prefetcher.after_action()
+    _wait_for_prefetch(prefetcher)
+    # Repopulate the cache for a second serve
+    prefetcher.after_action()
+    _wait_for_prefetch(prefetcher)
+    cached = prefetcher.on_action(FileReadAction(path='file.txt'))
+    assert cached is not None
+    cached._cause = 42  # callers mutate the observation they deliver
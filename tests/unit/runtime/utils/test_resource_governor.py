@@ -0,0 +1,57 @@
+import asyncio
+from types import SimpleNamespace
+
+import pytest
+
+from openhands.runtime.utils.memory_monitor import ResourceGovernor
+
+
+def _governor(tmp_path, budget=100) -> ResourceGovernor:
+    return ResourceGovernor(
+        spill_dir=str(tmp_path / 'spill'), output_budget_bytes=budget
+    )
+
+
+def test_small_observation_passes_through(tmp_path):
+    governor = _governor(tmp_path)
+    observation = SimpleNamespace(content='short output')
+    assert governor.govern_observation(observation) is observation
+    assert observation.content == 'short output'
+
+
+def test_oversized_observation_is_spilled(tmp_path):
+    governor = _governor(tmp_path, budget=100)
+    full_output = 'x' * 10_000
+    observation = SimpleNamespace(content=full_output)
+    governor.govern_observation(observation)
+
+    assert 'exceeded the 100 byte budget' in observation.content
+    assert len(observation.content) < len(full_output)
+    assert 'Full output saved to: ' in observation.content
+    spill_dir = tmp_path / 'spill'
+    spilled_files = list(spill_dir.iterdir())
+    assert len(spilled_files) == 1
+    assert spilled_files[0].read_text() == full_output
+
+
+def test_non_string_content_untouched(tmp_path):
+    governor = _governor(tmp_path)
+    observation = SimpleNamespace(content=None)
+    assert governor.govern_observation(observation) is observation
+
+
+def test_throttle_waits_for_pressure_to_drop(tmp_path, monkeypatch):
+    governor = _governor(tmp_path)
+    pressures = iter([0.95, 0.95, 0.5])
+    monkeypatch.setattr(governor, 'memory_pressure', lambda: next(pressures))
+
+    asyncio.run(governor.throttle())
+    # All high-pressure samples were consumed before admission
+    with pytest.raises(StopIteration):
+        governor.memory_pressure()
+
+
+def test_throttle_noop_below_threshold(tmp_path, monkeypatch):
+    governor = _governor(tmp_path)
+    monkeypatch.setattr(governor, 'memory_pressure', lambda: 0.1)
+    asyncio.run(governor.throttle())  # returns immediately
@@ -179,6 +179,13 @@ async def test_cleanup_session_connections():
                 'conn4': 'session2',
             }
         )
+        for (
+            connection_id,
+            sid,
+        ) in conversation_manager._local_connection_id_to_session_id.items():
+            conversation_manager._connection_ids_by_sid.setdefault(sid, set()).add(
+                connection_id
+            )
 
         await conversation_manager._close_session('session1')
 
@@ -195,3 +202,105 @@ async def test_cleanup_session_connections():
         assert sio.disconnect.await_count == 2
         sio.disconnect.assert_any_call('conn1')
         sio.disconnect.assert_any_call('conn2')
+
+
+@pytest.mark.asyncio
+async def test_indexed_connection_and_loop_lookups():
+    sio = get_mock_sio()
+    async with StandaloneConversationManager(
+        sio, OpenHandsConfig(), InMemoryFileStore(), MonitoringListener()
+    ) as conversation_manager:
+        session1 = MagicMock()
+        session1.user_id = 'user-a'
+        session2 = MagicMock()
+        session2.user_id = 'user-b'
+        conversation_manager._local_agent_loops_by_sid.update(
+            {'session1': session1, 'session2': session2}
+        )
+        conversation_manager._sids_by_user_id = {
+            'user-a': {'session1'},
+            'user-b': {'session2'},
+        }
+        conversation_manager._local_connection_id_to_session_id.update(
+            {'conn1': 'session1', 'conn2': 'session2'}
+        )
+        conversation_manager._connection_ids_by_sid = {
+            'session1': {'conn1'},
+            'session2': {'conn2'},
+        }
+
+        assert await conversation_manager.get_running_agent_loops() == {
+            'session1',
+            'session2',
+        }
+        assert await conversation_manager.get_running_agent_loops(
+            user_id='user-a'
+        ) == {'session1'}
+        assert await conversation_manager.get_running_agent_loops(
+            filter_to_sids={'session2'}
+        ) == {'session2'}
+
+        assert await conversation_manager.get_connections() == {
+            'conn1': 'session1',
+            'conn2': 'session2',
+        }
+        assert await conversation_manager.get_connections(
+            filter_to_sids={'session1'}
+        ) == {'conn1': 'session1'}
+        assert await conversation_manager.get_connections(user_id='user-b') == {
+            'conn2': 'session2'
+        }
+
+
+@pytest.mark.asyncio
+async def test_idle_session_check_reschedules_on_recent_activity():
+    import time as time_module
+
+    sio = get_mock_sio()
+    config = OpenHandsConfig()
+    config.sandbox.close_delay = 100
+    async with StandaloneConversationManager(
+        sio, config, InMemoryFileStore(), MonitoringListener()
+    ) as conversation_manager:
+        session = MagicMock()
+        session.last_active_ts = time_module.time() - 10  # active recently
+        conversation_manager._local_agent_loops_by_sid['session1'] = session
+        conversation_manager._expiry_heap = []
+
+        with patch.object(
+            conversation_manager, '_close_session', AsyncMock()
+        ) as close_mock:
+            await conversation_manager._maybe_close_idle_session('session1')
+            close_mock.assert_not_awaited()
+        # Rescheduled for the corrected deadline instead of closing
+        assert len(conversation_manager._expiry_heap) == 1
+        deadline, kind, sid = conversation_manager._expiry_heap[0]
+        assert kind == 'session'
+        assert sid == 'session1'
+        assert deadline == pytest.approx(session.last_active_ts + 100, abs=1)
+        conversation_manager._local_agent_loops_by_sid.clear()
+
+
+@pytest.mark.asyncio
+async def test_idle_session_check_closes_expired_session():
+    import time as time_module
+
+    from openhands.core.schema.agent import AgentState
+
+    sio = get_mock_sio()
+    config = OpenHandsConfig()
+    config.sandbox.close_delay = 100
+    async with StandaloneConversationManager(
+        sio, config, InMemoryFileStore(), MonitoringListener()
+    ) as conversation_manager:
+        session = MagicMock()
+        session.last_active_ts = time_module.time() - 1000  # long idle
+        session.agent_session.get_state.return_value = AgentState.FINISHED
+        conversation_manager._local_agent_loops_by_sid['session1'] = session
+
+        with patch.object(
+            conversation_manager, '_close_session', AsyncMock()
+        ) as close_mock:
+            await conversation_manager._maybe_close_idle_session('session1')
+            close_mock.assert_awaited_once_with('session1')
+        conversation_manager._local_agent_loops_by_sid.clear()
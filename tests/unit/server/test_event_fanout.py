@@ -0,0 +1,63 @@
+import asyncio
+from unittest.mock import AsyncMock, MagicMock
+
+import pytest
+
+from openhands.server.event_fanout import EventFanout
+
+
+@pytest.fixture
+def sio():
+    mock = MagicMock()
+    mock.emit = AsyncMock()
+    return mock
+
+
+@pytest.mark.asyncio
+async def test_single_event_keeps_message_shape(sio):
+    fanout = EventFanout(sio)
+    await fanout.emit_event('room-1', {'id': 1})
+    await asyncio.sleep(EventFanout.FLUSH_WINDOW_SECONDS * 3)
+    sio.emit.assert_awaited_once_with('oh_event', {'id': 1}, to='room-1')
+
+
+@pytest.mark.asyncio
+async def test_rapid_events_coalesce_into_one_batch(sio):
+    fanout = EventFanout(sio)
+    for i in range(5):
+        await fanout.emit_event('room-1', {'id': i})
+    await asyncio.sleep(EventFanout.FLUSH_WINDOW_SECONDS * 3)
+    sio.emit.assert_awaited_once_with(
+        'oh_event_batch', [{'id': i} for i in range(5)], to='room-1'
+    )
+
+
+@pytest.mark.asyncio
+async def test_size_limit_flushes_immediately(sio):
+    fanout = EventFanout(sio)
+    for i in range(EventFanout.MAX_BATCH_SIZE):
+        await fanout.emit_event('room-1', {'id': i})
+    # Flushed by size, before the window elapsed
+    sio.emit.assert_awaited_once()
+    name, batch = sio.emit.await_args.args
+    assert name == 'oh_event_batch'
+    assert len(batch) == EventFanout.MAX_BATCH_SIZE
+
+
+@pytest.mark.asyncio
+async def test_rooms_are_batched_independently(sio):
+    fanout = EventFanout(sio)
+    await fanout.emit_event('room-1', {'id': 1})
+    await fanout.emit_event('room-2', {'id': 2})
+    await asyncio.sleep(EventFanout.FLUSH_WINDOW_SECONDS * 3)
+    assert sio.emit.await_count == 2
+    destinations = {call.kwargs['to'] for call in sio.emit.await_args_list}
+    assert destinations == {'room-1', 'room-2'}
+
+
+@pytest.mark.asyncio
+async def test_flush_all_delivers_pending_immediately(sio):
+    fanout = EventFanout(sio)
+    await fanout.emit_event('room-1', {'id': 1})
+    await fanout.flush_all()
+    sio.emit.assert_awaited_once_with('oh_event', {'id': 1}, to='room-1')
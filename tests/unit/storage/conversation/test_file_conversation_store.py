@@ -200,3 +200,100 @@ async def test_get_all_metadata():
     assert results[0].title == 'First conversation'
     assert results[1].conversation_id == 'conv2'
     assert results[1].title == 'Second conversation'
+
+
+@pytest.mark.asyncio
+async def test_index_maintained_on_save_and_delete():
+    store = FileConversationStore(InMemoryFileStore({}))
+    for i in range(3):
+        await store.save_metadata(
+            ConversationMetadata(
+                conversation_id=f'conv{i}',
+                user_id='user',
+                selected_repository=None,
+            )
+        )
+    index = json.loads(store.file_store.read(store._index_path()))
+    assert set(index['entries'].keys()) == {'conv0', 'conv1', 'conv2'}
+
+    await store.delete_metadata('conv1')
+    index = json.loads(store.file_store.read(store._index_path()))
+    assert set(index['entries'].keys()) == {'conv0', 'conv2'}
+
+
+@pytest.mark.asyncio
+async def test_search_reads_only_page_metadata():
+    store = FileConversationStore(InMemoryFileStore({}))
+    for i in range(10):
+        await store.save_metadata(
+            ConversationMetadata(
+                conversation_id=f'conv{i}',
+                user_id='user',
+                selected_repository=None,
+            )
+        )
+
+    reads = []
+    original_read = store.file_store.read
+
+    def counting_read(path):
+        reads.append(path)
+        return original_read(path)
+
+    store.file_store.read = counting_read
+    result = await store.search(limit=2)
+    assert len(result.results) == 2
+    metadata_reads = [path for path in reads if path.endswith('metadata.json')]
+    # Only the two conversations on the page were read
+    assert len(metadata_reads) == 2
+
+
+@pytest.mark.asyncio
+async def test_search_self_heals_stale_index_entries():
+    store = FileConversationStore(InMemoryFileStore({}))
+    for i in range(2):
+        await store.save_metadata(
+            ConversationMetadata(
+                conversation_id=f'conv{i}',
+                user_id='user',
+                selected_repository=None,
+            )
+        )
+    # Remove a metadata file behind the index's back
+    store.file_store.delete(
+        get_conversation_metadata_filename('conv0')
+    )
+    result = await store.search()
+    assert [c.conversation_id for c in result.results] == ['conv1']
+    index = json.loads(store.file_store.read(store._index_path()))
+    assert set(index['entries'].keys()) == {'conv1'}
+
+
+@pytest.mark.asyncio
+async def test_index_reconciles_missing_entries():
+    """A conversation another writer lost from the index is recovered from
+    the metadata directory listing."""
+    store = FileConversationStore(InMemoryFileStore({}))
+    await store.save_metadata(
+        ConversationMetadata(
+            conversation_id='conv0', user_id='user', selected_repository=None
+        )
+    )
+    # Simulate a concurrent writer's index overwrite losing conv0, while a
+    # second conversation exists only on disk
+    store.file_store.write(
+        get_conversation_metadata_filename('conv1'),
+        json.dumps(
+            {
+                'conversation_id': 'conv1',
+                'user_id': 'user',
+                'selected_repository': None,
+                'title': 'lost one',
+                'created_at': '2025-01-16T19:51:04.886331Z',
+            }
+        ),
+    )
+    store.file_store.write(store._index_path(), json.dumps({'entries': {}}))
+
+    result = await store.search()
+    assert {c.conversation_id for c in result.results} == {'conv0', 'conv1'}
@@ -0,0 +1,53 @@
+import pytest
+
+from openhands.storage.async_files import (
+    AsyncFileStore,
+    AsyncLocalFileStore,
+    get_async_file_store,
+)
+from openhands.storage.local import LocalFileStore
+from openhands.storage.memory import InMemoryFileStore
+
+
+@pytest.mark.asyncio
+async def test_single_operations_roundtrip():
+    store = get_async_file_store(InMemoryFileStore())
+    await store.write('dir/file.txt', 'hello')
+    assert await store.read('dir/file.txt') == 'hello'
+    assert 'dir/' in await store.list('')
+    await store.delete('dir/file.txt')
+    with pytest.raises(FileNotFoundError):
+        await store.read('dir/file.txt')
+
+
+@pytest.mark.asyncio
+async def test_read_many_returns_none_for_missing():
+    store = get_async_file_store(InMemoryFileStore())
+    await store.write('a.txt', 'A')
+    await store.write('c.txt', 'C')
+    results = await store.read_many(['a.txt', 'b.txt', 'c.txt'])
+    assert results == ['A', None, 'C']
+
+
+@pytest.mark.asyncio
+async def test_write_many_roundtrip():
+    store = get_async_file_store(InMemoryFileStore())
+    await store.write_many([('a.txt', 'A'), ('b.txt', 'B')])
+    assert await store.read_many(['a.txt', 'b.txt']) == ['A', 'B']
+
+
+@pytest.mark.asyncio
+async def test_local_batched_operations(tmp_path):
+    store = get_async_file_store(LocalFileStore(str(tmp_path)))
+    await store.write_many([(f'{i}.txt', f'event {i}') for i in range(25)])
+    results = await store.read_many([f'{i}.txt' for i in range(25)])
+    assert results == [f'event {i}' for i in range(25)]
+    assert await store.read_many(['missing.txt']) == [None]
+
+
+def test_get_async_file_store_selects_backend(tmp_path):
+    local = get_async_file_store(LocalFileStore(str(tmp_path)))
+    assert isinstance(local, AsyncLocalFileStore)
+    generic = get_async_file_store(InMemoryFileStore())
+    assert isinstance(generic, AsyncFileStore)
+    assert not isinstance(generic, AsyncLocalFileStore)
@@ -1,3 +1,5 @@
+import gzip
+import json
 import time
 from unittest.mock import MagicMock
 
@@ -26,6 +28,14 @@ class MockFileStore(FileStore):
             del self.files[path]
 
 
+def decode_payload(kwargs):
+    """Decode the (possibly gzipped) request body sent to the webhook."""
+    body = kwargs['content']
+    if kwargs.get('headers', {}).get('Content-Encoding') == 'gzip':
+        body = gzip.decompress(body)
+    return json.loads(body)
+
+
 class TestBatchedWebHookFileStore:
     @pytest.fixture
     def mock_client(self):
@@ -63,10 +73,10 @@ class TestBatchedWebHookFileStore:
         mock_client.post.assert_called_once()
         args, kwargs = mock_client.post.call_args
         assert args[0] == 'http://example.com'
-        assert 'json' in kwargs
+        assert 'content' in kwargs
 
         # Check the batch payload
-        batch_payload = kwargs['json']
+        batch_payload = decode_payload(kwargs)
         assert isinstance(batch_payload, list)
         assert len(batch_payload) == 1
         assert batch_payload[0]['method'] == 'POST'
@@ -88,10 +98,10 @@ class TestBatchedWebHookFileStore:
         mock_client.post.assert_called_once()
         args, kwargs = mock_client.post.call_args
         assert args[0] == 'http://example.com'
-        assert 'json' in kwargs
+        assert 'content' in kwargs
 
         # Check the batch payload
-        batch_payload = kwargs['json']
+        batch_payload = decode_payload(kwargs)
         assert isinstance(batch_payload, list)
         assert len(batch_payload) == 1
         assert batch_payload[0]['method'] == 'DELETE'
@@ -110,10 +120,10 @@ class TestBatchedWebHookFileStore:
         mock_client.post.assert_called_once()
         args, kwargs = mock_client.post.call_args
         assert args[0] == 'http://example.com'
-        assert 'json' in kwargs
+        assert 'content' in kwargs
 
         # Check the batch payload
-        batch_payload = kwargs['json']
+        batch_payload = decode_payload(kwargs)
         assert isinstance(batch_payload, list)
         assert len(batch_payload) == 1
         assert batch_payload[0]['method'] == 'POST'
@@ -133,10 +143,10 @@ class TestBatchedWebHookFileStore:
         mock_client.post.assert_called_once()
         args, kwargs = mock_client.post.call_args
         assert args[0] == 'http://example.com'
-        assert 'json' in kwargs
+        assert 'content' in kwargs
 
         # Check the batch payload
-        batch_payload = kwargs['json']
+        batch_payload = decode_payload(kwargs)
         assert isinstance(batch_payload, list)
         assert len(batch_payload) == 1
         assert batch_payload[0]['method'] == 'POST'
@@ -157,10 +167,10 @@ class TestBatchedWebHookFileStore:
         mock_client.post.assert_called_once()
         args, kwargs = mock_client.post.call_args
         assert args[0] == 'http://example.com'
-        assert 'json' in kwargs
+        assert 'content' in kwargs
 
         # Check the batch payload
-        batch_payload = kwargs['json']
+        batch_payload = decode_payload(kwargs)
         assert isinstance(batch_payload, list)
         assert len(batch_payload) == 1
         assert batch_payload[0]['method'] == 'POST'
@@ -180,10 +190,10 @@ class TestBatchedWebHookFileStore:
         mock_client.post.assert_called_once()
         args, kwargs = mock_client.post.call_args
         assert args[0] == 'http://example.com'
-        assert 'json' in kwargs
+        assert 'content' in kwargs
 
         # Check the batch payload
-        batch_payload = kwargs['json']
+        batch_payload = decode_payload(kwargs)
         assert isinstance(batch_payload, list)
         assert len(batch_payload) == 3
 
@@ -214,10 +224,10 @@ class TestBatchedWebHookFileStore:
         mock_client.post.assert_called_once()
         args, kwargs = mock_client.post.call_args
         assert args[0] == 'http://example.com'
-        assert 'json' in kwargs
+        assert 'content' in kwargs
 
         # Check the batch payload
-        batch_payload = kwargs['json']
+        batch_payload = decode_payload(kwargs)
         assert isinstance(batch_payload, list)
         assert len(batch_payload) == 1
 
@@ -233,3 +243,29 @@ class TestBatchedWebHookFileStore:
 
         decoded = base64.b64decode(batch_payload[0]['content'].encode('ascii'))
         assert decoded == binary_content
+
+    def test_large_payload_is_compressed(self, batched_store, mock_client):
+        large_content = 'y' * 20000  # over the compression threshold
+        batched_store.batch_size_limit_bytes = 10**9  # avoid size-triggered path
+        batched_store.write('/big.txt', large_content)
+        batched_store.flush()
+
+        mock_client.post.assert_called_once()
+        _, kwargs = mock_client.post.call_args
+        assert kwargs['headers']['Content-Encoding'] == 'gzip'
+        payload = decode_payload(kwargs)
+        assert payload[0]['content'] == large_content
+
+    def test_timer_measures_batch_age_not_last_insert(
+        self, batched_store, mock_client
+    ):
+        # A second insert before the timeout must not reset the timer: the
+        # batch flushes once the OLDEST update reaches the 0.1s timeout
+        batched_store.write('/age.txt', 'version 0')
+        time.sleep(0.06)
+        batched_store.write('/age.txt', 'version 1')
+        time.sleep(0.07)  # t ~= 0.13: past first-insert age, not past reset
+        mock_client.post.assert_called_once()
+        _, kwargs = mock_client.post.call_args
+        payload = decode_payload(kwargs)
+        assert payload[0]['content'] == 'version 1'
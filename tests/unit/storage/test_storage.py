@@ -139,6 +139,12 @@ class TestS3FileStore(TestCase, _StorageTest):
         with patch('boto3.client', lambda service, **kwargs: _MockS3Client()):
             self.store = S3FileStore('dear-liza')
 
+    def test_multipart_write_roundtrip(self):
+        # Force the multipart path with a tiny threshold
+        self.store.multipart_threshold = 4
+        self.store.write('big.txt', '0123456789')
+        self.assertEqual(self.store.read('big.txt'), '0123456789')
+
 
 # I would have liked to use cloud-storage-mocker here but the python versions were incompatible :(
 # If we write tests for the S3 storage class I would definitely recommend we use moto.
@@ -269,6 +275,23 @@ class _MockS3Client:
             )
         self.objects_by_bucket[Bucket].pop(Key, None)
 
+    def delete_objects(self, Bucket: str, Delete: dict) -> None:
+        for obj in Delete['Objects']:
+            self.delete_object(Bucket=Bucket, Key=obj['Key'])
+
+    def get_paginator(self, operation_name: str):
+        assert operation_name == 'list_objects_v2'
+        client = self
+
+        class _Paginator:
+            def paginate(self, **kwargs):
+                yield client.list_objects_v2(**kwargs)
+
+        return _Paginator()
+
+    def upload_fileobj(self, Fileobj, Bucket: str, Key: str, Config=None) -> None:
+        self.put_object(Bucket=Bucket, Key=Key, Body=Fileobj.read())
+
 
 @dataclass
 class _MockS3Object:
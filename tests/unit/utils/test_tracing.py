@@ -0,0 +1,55 @@
+import pytest
+
+from openhands.utils.tracing import (
+    TraceSpan,
+    register_trace_sink,
+    trace_span,
+    unregister_trace_sink,
+)
+
+
+@pytest.fixture
+def spans():
+    collected: list[TraceSpan] = []
+    register_trace_sink(collected.append)
+    yield collected
+    unregister_trace_sink(collected.append)
+
+
+def test_span_delivered_with_attributes(spans):
+    with trace_span('agent_controller.llm_step', conversation_id='abc', step=3):
+        pass
+    assert len(spans) == 1
+    span = spans[0]
+    assert span.name == 'agent_controller.llm_step'
+    assert span.attributes == {'conversation_id': 'abc', 'step': 3}
+    assert span.end_time_ns >= span.start_time_ns
+    assert span.duration_ms >= 0
+    assert span.error is None
+
+
+def test_span_records_error_and_reraises(spans):
+    with pytest.raises(ValueError):
+        with trace_span('runtime.run_action', conversation_id='abc'):
+            raise ValueError('boom')
+    assert len(spans) == 1
+    assert spans[0].error == 'ValueError: boom'
+
+
+def test_no_sink_is_a_no_op():
+    # Must not raise and must not keep any state
+    with trace_span('agent_controller.on_event'):
+        pass
+
+
+def test_failing_sink_does_not_break_the_traced_path(spans):
+    def broken_sink(span):
+        raise RuntimeError('sink down')
+
+    register_trace_sink(broken_sink)
+    try:
+        with trace_span('agent_controller.event_append'):
+            pass
+    finally:
+        unregister_trace_sink(broken_sink)
+    assert len(spans) == 1